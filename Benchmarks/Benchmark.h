@@ -0,0 +1,46 @@
+/*
+ * This source file is part of MyGUI. For the latest info, see http://mygui.info/
+ * Distributed under the MIT License
+ * (See accompanying file COPYING.MIT or copy at http://opensource.org/licenses/MIT)
+ */
+
+#ifndef BENCHMARK_H_
+#define BENCHMARK_H_
+
+#include <string>
+#include <vector>
+#include <utility>
+#include <stddef.h>
+
+namespace benchmark
+{
+
+	typedef std::pair<std::string, size_t> PairValue;
+	typedef std::vector<PairValue> VectorValue;
+
+	/** Single measured case. Runner calls initialise once, then for every
+		iteration setUp/run/tearDown (only run is timed), then shutdown.
+	*/
+	class Benchmark
+	{
+	public:
+		virtual ~Benchmark() { }
+
+		virtual std::string getName() const = 0;
+
+		/** Fixed input parameters of benchmark, written to report */
+		virtual void getParameters(VectorValue& _result) const { }
+		/** Counters collected after last iteration, written to report */
+		virtual void getCounters(VectorValue& _result) const { }
+
+		virtual void initialise() { }
+		virtual void shutdown() { }
+
+		virtual void setUp() { }
+		virtual void run() = 0;
+		virtual void tearDown() { }
+	};
+
+} // namespace benchmark
+
+#endif // BENCHMARK_H_
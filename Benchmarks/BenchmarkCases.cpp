@@ -0,0 +1,789 @@
+/*
+ * This source file is part of MyGUI. For the latest info, see http://mygui.info/
+ * Distributed under the MIT License
+ * (See accompanying file COPYING.MIT or copy at http://opensource.org/licenses/MIT)
+ */
+
+#include "BenchmarkCases.h"
+#include "MyGUI_DummyRenderManager.h"
+#include "MyGUI_DummyDataManager.h"
+#include "MyGUI_DataMemoryStream.h"
+#include <fstream>
+#include <sstream>
+
+namespace benchmark
+{
+
+	namespace
+	{
+
+		const char* const LayoutFileName = "MyGUI_Benchmark.layout";
+		const char* const SkinsFileName = "MyGUI_BenchmarkSkins.xml";
+		const char* const BinarySkinsFileName = "MyGUI_BenchmarkSkinsBinary.xml";
+		const char* const PackFileName = "MyGUI_Benchmark.pak";
+		const char* const CompressedPackFileName = "MyGUI_BenchmarkLZ4.pak";
+		const char* const FontsFileName = "MyGUI_BenchmarkFonts.xml";
+
+		const size_t LayoutChildren = 19;
+
+		void writeFile(const std::string& _dataDir, const std::string& _name, const std::string& _content)
+		{
+			std::string fileName = _dataDir + "/" + _name;
+			std::ofstream stream(fileName.c_str(), std::ios_base::out | std::ios_base::binary);
+			MYGUI_ASSERT(stream.is_open(), "Can't write benchmark data '" << fileName << "'");
+			stream << _content;
+			stream.close();
+
+			// data folder was indexed before file was written
+			MyGUI::DummyDataManager::getInstance().updateLocations();
+		}
+
+		std::string getSkinName(size_t _index)
+		{
+			return MyGUI::utility::toString("BenchmarkSkin_", _index);
+		}
+
+		std::string generateSkins(size_t _skins)
+		{
+			const char* const states[] = { "disabled", "normal", "highlighted", "pushed" };
+
+			std::ostringstream stream;
+			stream << "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n";
+			stream << "<MyGUI type=\"Resource\" version=\"1.1\">\n";
+			for (size_t skin = 0; skin < _skins; ++skin)
+			{
+				int column = (int)(skin % 8) * 24;
+				stream << "\t<Resource type=\"ResourceSkin\" name=\"" << getSkinName(skin) << "\" size=\"23 21\" texture=\"MyGUI_BlueWhiteSkins.png\">\n";
+				stream << "\t\t<BasisSkin type=\"SubSkin\" offset=\"0 0 21 21\" align=\"Left Top\">\n";
+				for (int state = 0; state < 4; ++state)
+					stream << "\t\t\t<State name=\"" << states[state] << "\" offset=\"" << column + 2 << " " << state * 22 + 2 << " 21 21\"/>\n";
+				stream << "\t\t</BasisSkin>\n";
+				stream << "\t\t<BasisSkin type=\"SimpleText\" offset=\"22 2 1 19\" align=\"Stretch\">\n";
+				for (int state = 0; state < 4; ++state)
+					stream << "\t\t\t<State name=\"" << states[state] << "\" colour=\"0 0 0\" shift=\"" << (state == 3 ? 1 : 0) << "\"/>\n";
+				stream << "\t\t</BasisSkin>\n";
+				stream << "\t</Resource>\n";
+			}
+			stream << "</MyGUI>\n";
+
+			return stream.str();
+		}
+
+		std::string getFontName(size_t _index)
+		{
+			return MyGUI::utility::toString("BenchmarkFont_", _index);
+		}
+
+		// deterministic sequence, results must not change between runs
+		size_t nextRandom(size_t& _seed)
+		{
+			_seed = (_seed * 1103515245 + 12345) & 0x7fffffff;
+			return _seed >> 8;
+		}
+
+	} // namespace
+
+	LayoutLoadBenchmark::LayoutLoadBenchmark(const std::string& _dataDir, size_t _windows) :
+		mDataDir(_dataDir),
+		mWindows(_windows),
+		mRootWidgets(0)
+	{
+	}
+
+	std::string LayoutLoadBenchmark::getName() const
+	{
+		return "layout_load";
+	}
+
+	void LayoutLoadBenchmark::getParameters(VectorValue& _result) const
+	{
+		_result.push_back(PairValue("windows", mWindows));
+		_result.push_back(PairValue("widgets", mWindows * (LayoutChildren + 1)));
+	}
+
+	void LayoutLoadBenchmark::getCounters(VectorValue& _result) const
+	{
+		const MyGUI::TextLayoutCache& cache = MyGUI::FontManager::getInstance().getTextLayoutCache();
+		_result.push_back(PairValue("root_widgets", mRootWidgets));
+		_result.push_back(PairValue("text_layout_cache_hits", cache.getHits()));
+		_result.push_back(PairValue("text_layout_cache_misses", cache.getMisses()));
+	}
+
+	void LayoutLoadBenchmark::initialise()
+	{
+		const char* const types[] = { "Button", "EditBox", "TextBox", "Button" };
+		const char* const skins[] = { "Button", "EditBox", "TextBox", "CheckBox" };
+
+		std::ostringstream stream;
+		stream << "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n";
+		stream << "<MyGUI type=\"Layout\" version=\"3.2.0\">\n";
+		for (size_t window = 0; window < mWindows; ++window)
+		{
+			stream << "\t<Widget type=\"Window\" skin=\"WindowCS\" position=\"" << (window % 64) * 8 << " " << (window % 48) * 8
+				<< " 300 480\" layer=\"Overlapped\" name=\"Window" << window << "\">\n";
+			stream << "\t\t<Property key=\"Caption\" value=\"Window " << window << "\"/>\n";
+			for (size_t child = 0; child < LayoutChildren; ++child)
+			{
+				stream << "\t\t<Widget type=\"" << types[child % 4] << "\" skin=\"" << skins[child % 4]
+					<< "\" position=\"8 " << (child * 22 + 4) << " 260 20\" align=\"HStretch Top\">\n";
+				stream << "\t\t\t<Property key=\"Caption\" value=\"Item " << child << "\"/>\n";
+				stream << "\t\t</Widget>\n";
+			}
+			stream << "\t</Widget>\n";
+		}
+		stream << "</MyGUI>\n";
+
+		writeFile(mDataDir, LayoutFileName, stream.str());
+	}
+
+	void LayoutLoadBenchmark::setUp()
+	{
+		MyGUI::FontManager::getInstance().getTextLayoutCache().resetStatistics();
+	}
+
+	void LayoutLoadBenchmark::run()
+	{
+		mWidgets = MyGUI::LayoutManager::getInstance().loadLayout(LayoutFileName);
+	}
+
+	void LayoutLoadBenchmark::tearDown()
+	{
+		mRootWidgets = mWidgets.size();
+		MyGUI::LayoutManager::getInstance().unloadLayout(mWidgets);
+		MyGUI::WidgetManager::getInstance()._deleteDelayWidgets();
+		mWidgets.clear();
+
+		// parsed layout is cached as resource, remove it to measure parsing too
+		MyGUI::ResourceManager::getInstance().removeByName(LayoutFileName);
+	}
+
+	SkinLoadBenchmark::SkinLoadBenchmark(const std::string& _dataDir, size_t _skins, bool _binary) :
+		mDataDir(_dataDir),
+		mSkins(_skins),
+		mBinary(_binary)
+	{
+	}
+
+	std::string SkinLoadBenchmark::getName() const
+	{
+		return mBinary ? "resource_load_skins_binary" : "resource_load_skins";
+	}
+
+	void SkinLoadBenchmark::getParameters(VectorValue& _result) const
+	{
+		_result.push_back(PairValue("skins", mSkins));
+	}
+
+	void SkinLoadBenchmark::initialise()
+	{
+		writeFile(mDataDir, SkinsFileName, generateSkins(mSkins));
+
+		if (mBinary)
+		{
+			bool result = MyGUI::ResourceManager::getInstance().compile(SkinsFileName, mDataDir + "/" + BinarySkinsFileName);
+			MYGUI_ASSERT(result, "Can't compile '" << SkinsFileName << "'");
+		}
+	}
+
+	void SkinLoadBenchmark::run()
+	{
+		MyGUI::ResourceManager::getInstance().load(mBinary ? BinarySkinsFileName : SkinsFileName);
+	}
+
+	void SkinLoadBenchmark::tearDown()
+	{
+		for (size_t skin = 0; skin < mSkins; ++skin)
+			MyGUI::ResourceManager::getInstance().removeByName(getSkinName(skin));
+	}
+
+	XmlParseBenchmark::XmlParseBenchmark(size_t _skins, bool _arena, bool _binary) :
+		mSkins(_skins),
+		mArena(_arena),
+		mBinary(_binary),
+		mElements(0)
+	{
+	}
+
+	std::string XmlParseBenchmark::getName() const
+	{
+		std::string name = "xml_parse";
+		if (mBinary)
+			name += "_binary";
+		if (mArena)
+			name += "_arena";
+		return name;
+	}
+
+	void XmlParseBenchmark::getParameters(VectorValue& _result) const
+	{
+		_result.push_back(PairValue("skins", mSkins));
+		_result.push_back(PairValue("bytes", mText.size()));
+	}
+
+	void XmlParseBenchmark::getCounters(VectorValue& _result) const
+	{
+		_result.push_back(PairValue("elements", mElements));
+	}
+
+	void XmlParseBenchmark::initialise()
+	{
+		mText = generateSkins(mSkins);
+
+		if (mBinary)
+		{
+			MyGUI::DataMemoryStream data((unsigned char*)&mText[0], mText.size());
+			MyGUI::xml::Document document;
+			bool result = document.open(&data);
+			MYGUI_ASSERT(result, document.getLastError());
+
+			std::ostringstream stream;
+			document.saveBinary(stream);
+			mText = stream.str();
+		}
+	}
+
+	void XmlParseBenchmark::run()
+	{
+		MyGUI::DataMemoryStream data((unsigned char*)&mText[0], mText.size());
+		MyGUI::xml::Document document;
+		document.setArenaAllocation(mArena);
+		bool result = document.open(&data);
+		MYGUI_ASSERT(result, document.getLastError());
+
+		mElements = 0;
+		MyGUI::xml::ElementEnumerator resource = document.getRoot()->getElementEnumerator();
+		while (resource.next())
+		{
+			mElements ++;
+			MyGUI::xml::ElementEnumerator basis = resource->getElementEnumerator();
+			while (basis.next())
+			{
+				MyGUI::xml::ElementEnumerator state = basis->getElementEnumerator();
+				while (state.next())
+					mElements ++;
+				mElements ++;
+			}
+		}
+	}
+
+	FontLoadBenchmark::FontLoadBenchmark(const std::string& _dataDir, size_t _fonts, bool _lazy) :
+		mDataDir(_dataDir),
+		mFonts(_fonts),
+		mLazy(_lazy),
+		mLoaded(0)
+	{
+	}
+
+	std::string FontLoadBenchmark::getName() const
+	{
+		return mLazy ? "resource_load_fonts_lazy" : "resource_load_fonts";
+	}
+
+	void FontLoadBenchmark::getParameters(VectorValue& _result) const
+	{
+		_result.push_back(PairValue("fonts", mFonts));
+	}
+
+	void FontLoadBenchmark::getCounters(VectorValue& _result) const
+	{
+		_result.push_back(PairValue("loaded", mLoaded));
+	}
+
+	void FontLoadBenchmark::initialise()
+	{
+		std::ostringstream stream;
+		stream << "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n";
+		stream << "<MyGUI type=\"Resource\" version=\"1.1\">\n";
+		for (size_t font = 0; font < mFonts; ++font)
+		{
+			stream << "\t<Resource type=\"ResourceTrueTypeFont\" name=\"" << getFontName(font) << "\">\n";
+			stream << "\t\t<Property key=\"Source\" value=\"DejaVuSans.ttf\"/>\n";
+			stream << "\t\t<Property key=\"Size\" value=\"" << 8 + font * 2 << "\"/>\n";
+			stream << "\t\t<Property key=\"Resolution\" value=\"96\"/>\n";
+			stream << "\t\t<Property key=\"Antialias\" value=\"" << (font % 2 == 0 ? "false" : "true") << "\"/>\n";
+			stream << "\t\t<Property key=\"Lazy\" value=\"" << (mLazy ? "true" : "false") << "\"/>\n";
+			stream << "\t\t<Codes>\n";
+			stream << "\t\t\t<Code range=\"32 126\"/>\n";
+			stream << "\t\t\t<Code range=\"1025 1105\"/>\n";
+			stream << "\t\t</Codes>\n";
+			stream << "\t</Resource>\n";
+		}
+		stream << "</MyGUI>\n";
+
+		writeFile(mDataDir, FontsFileName, stream.str());
+	}
+
+	void FontLoadBenchmark::run()
+	{
+		MyGUI::ResourceManager::getInstance().load(FontsFileName);
+	}
+
+	void FontLoadBenchmark::tearDown()
+	{
+		mLoaded = 0;
+		for (size_t font = 0; font < mFonts; ++font)
+		{
+			if (MyGUI::ResourceManager::getInstance().getByName(getFontName(font), false) != nullptr)
+				mLoaded ++;
+			MyGUI::ResourceManager::getInstance().removeByName(getFontName(font));
+		}
+	}
+
+	TextUpdateBenchmark::TextUpdateBenchmark(size_t _length, int _maxWidth, bool _append) :
+		mLength(_length),
+		mMaxWidth(_maxWidth),
+		mAppend(_append),
+		mFont(nullptr)
+	{
+	}
+
+	std::string TextUpdateBenchmark::getName() const
+	{
+		std::string name = mAppend ? "text_append" : "text_update";
+		return mMaxWidth < 0 ? name : name + "_wordwrap";
+	}
+
+	void TextUpdateBenchmark::getParameters(VectorValue& _result) const
+	{
+		_result.push_back(PairValue("characters", mLength));
+		if (mMaxWidth >= 0)
+			_result.push_back(PairValue("max_width", (size_t)mMaxWidth));
+	}
+
+	void TextUpdateBenchmark::getCounters(VectorValue& _result) const
+	{
+		_result.push_back(PairValue("lines", mTextView.getData().size()));
+		_result.push_back(PairValue("view_width", (size_t)mTextView.getViewSize().width));
+		_result.push_back(PairValue("view_height", (size_t)mTextView.getViewSize().height));
+	}
+
+	void TextUpdateBenchmark::initialise()
+	{
+		const char* const words[] = { "lorem", "ipsum", "dolor", "sit", "amet", "#FF0000colour#000000", "consectetur", "adipiscing", "elit", "sed", "do" };
+		const size_t count = sizeof(words) / sizeof(words[0]);
+
+		std::string text;
+		size_t seed = 1;
+		size_t lineLength = 0;
+		while (text.size() < mLength)
+		{
+			text += words[nextRandom(seed) % count];
+			lineLength ++;
+			if (lineLength == 60)
+			{
+				text += "\n";
+				lineLength = 0;
+			}
+			else
+			{
+				text += " ";
+			}
+		}
+		text.resize(mLength);
+		mText = text;
+
+		MyGUI::FontManager& manager = MyGUI::FontManager::getInstance();
+		mFont = manager.getByName(manager.getDefaultFont());
+		MYGUI_ASSERT(mFont != nullptr, "Default font not found");
+
+		mTextView.update(mText, mFont, mFont->getDefaultHeight(), MyGUI::Align::Default, MyGUI::RenderManager::getInstance().getVertexFormat(), mMaxWidth);
+	}
+
+	void TextUpdateBenchmark::setUp()
+	{
+		if (mAppend)
+			mText.append(MyGUI::UString("\nlorem ipsum dolor sit amet"));
+		else
+			mTextView.invalidate();
+	}
+
+	void TextUpdateBenchmark::run()
+	{
+		mTextView.update(mText, mFont, mFont->getDefaultHeight(), MyGUI::Align::Default, MyGUI::RenderManager::getInstance().getVertexFormat(), mMaxWidth);
+	}
+
+	TextRenderBenchmark::TextRenderBenchmark(size_t _lines) :
+		mLines(_lines),
+		mEdit(nullptr)
+	{
+	}
+
+	std::string TextRenderBenchmark::getName() const
+	{
+		return "text_render";
+	}
+
+	void TextRenderBenchmark::getParameters(VectorValue& _result) const
+	{
+		_result.push_back(PairValue("lines", mLines));
+	}
+
+	void TextRenderBenchmark::getCounters(VectorValue& _result) const
+	{
+		const MyGUI::DummyFrameStatistics& statistics = MyGUI::DummyRenderManager::getInstance().getDeviceStatistics();
+		_result.push_back(PairValue("characters", mEdit->getTextLength()));
+		_result.push_back(PairValue("vertices_rendered", statistics.verticesRendered));
+		_result.push_back(PairValue("vertices_uploaded", statistics.verticesUploaded));
+	}
+
+	void TextRenderBenchmark::initialise()
+	{
+		std::string text;
+		for (size_t line = 0; line < mLines; ++line)
+		{
+			if (line != 0)
+				text += "\n";
+			text += MyGUI::utility::toString("#00FF00[", line, "]#000000 lorem ipsum dolor sit amet consectetur adipiscing elit sed do");
+		}
+
+		mEdit = MyGUI::Gui::getInstance().createWidget<MyGUI::EditBox>("EditBoxStretch", MyGUI::IntCoord(10, 10, 600, 400), MyGUI::Align::Default, "Overlapped");
+		mEdit->setEditMultiLine(true);
+		mEdit->setEditReadOnly(true);
+		mEdit->setEditStatic(true);
+		mEdit->setMaxTextLength(text.size());
+		mEdit->setCaption(text);
+		mEdit->setVScrollPosition(mEdit->getVScrollRange());
+
+		MyGUI::DummyRenderManager::getInstance().drawOneFrame();
+	}
+
+	void TextRenderBenchmark::shutdown()
+	{
+		MyGUI::WidgetManager::getInstance().destroyWidget(mEdit);
+		MyGUI::WidgetManager::getInstance()._deleteDelayWidgets();
+		mEdit = nullptr;
+	}
+
+	void TextRenderBenchmark::run()
+	{
+		// scrolling by line makes text vertices out of date without layout
+		size_t range = mEdit->getVScrollRange();
+		mEdit->setVScrollPosition(mEdit->getVScrollPosition() == range ? range - 1 : range);
+
+		MyGUI::DummyRenderManager::getInstance().drawOneFrame();
+	}
+
+	EditTypingBenchmark::EditTypingBenchmark(size_t _length, bool _wordWrap) :
+		mLength(_length),
+		mWordWrap(_wordWrap),
+		mEdit(nullptr)
+	{
+	}
+
+	std::string EditTypingBenchmark::getName() const
+	{
+		return mWordWrap ? "edit_typing_wordwrap" : "edit_typing";
+	}
+
+	void EditTypingBenchmark::getParameters(VectorValue& _result) const
+	{
+		_result.push_back(PairValue("characters", mLength));
+	}
+
+	void EditTypingBenchmark::getCounters(VectorValue& _result) const
+	{
+		_result.push_back(PairValue("text_length", mEdit->getTextLength()));
+		_result.push_back(PairValue("cursor", mEdit->getTextCursor()));
+	}
+
+	void EditTypingBenchmark::initialise()
+	{
+		const char* const words[] = { "lorem", "ipsum", "dolor", "sit", "amet", "consectetur", "adipiscing", "elit", "sed", "do" };
+		const size_t count = sizeof(words) / sizeof(words[0]);
+
+		std::string text;
+		size_t seed = 1;
+		size_t lineLength = 0;
+		while (text.size() < mLength)
+		{
+			text += words[nextRandom(seed) % count];
+			lineLength ++;
+			text += lineLength % 12 == 0 ? "\n" : " ";
+		}
+		text.resize(mLength);
+
+		mEdit = MyGUI::Gui::getInstance().createWidget<MyGUI::EditBox>("EditBoxStretch", MyGUI::IntCoord(10, 10, 600, 400), MyGUI::Align::Default, "Overlapped");
+		mEdit->setEditMultiLine(true);
+		mEdit->setEditWordWrap(mWordWrap);
+		mEdit->setMaxTextLength(mLength * 2);
+		mEdit->setCaption(text);
+		mEdit->setTextCursor(mLength / 2);
+		MyGUI::InputManager::getInstance().setKeyFocusWidget(mEdit);
+
+		MyGUI::DummyRenderManager::getInstance().drawOneFrame();
+	}
+
+	void EditTypingBenchmark::shutdown()
+	{
+		MyGUI::InputManager::getInstance().resetKeyFocusWidget();
+		MyGUI::WidgetManager::getInstance().destroyWidget(mEdit);
+		MyGUI::WidgetManager::getInstance()._deleteDelayWidgets();
+		mEdit = nullptr;
+	}
+
+	void EditTypingBenchmark::run()
+	{
+		MyGUI::InputManager::getInstance().injectKeyPress(MyGUI::KeyCode::A, 'a');
+		MyGUI::InputManager::getInstance().injectKeyRelease(MyGUI::KeyCode::A);
+		MyGUI::DummyRenderManager::getInstance().drawOneFrame();
+	}
+
+	WidgetPickingBenchmark::WidgetPickingBenchmark(size_t _trees, size_t _depth, size_t _queries) :
+		mTrees(_trees),
+		mDepth(_depth),
+		mQueries(_queries),
+		mHits(0)
+	{
+	}
+
+	std::string WidgetPickingBenchmark::getName() const
+	{
+		return "widget_picking";
+	}
+
+	void WidgetPickingBenchmark::getParameters(VectorValue& _result) const
+	{
+		_result.push_back(PairValue("trees", mTrees));
+		_result.push_back(PairValue("depth", mDepth));
+		_result.push_back(PairValue("queries", mQueries));
+	}
+
+	void WidgetPickingBenchmark::getCounters(VectorValue& _result) const
+	{
+		_result.push_back(PairValue("hits", mHits));
+	}
+
+	void WidgetPickingBenchmark::initialise()
+	{
+		const MyGUI::IntSize& viewSize = MyGUI::RenderManager::getInstance().getViewSize();
+		int size = (int)mDepth * 2 + 32;
+		int columns = (std::max)(viewSize.width / size, 1);
+
+		for (size_t tree = 0; tree < mTrees; ++tree)
+		{
+			MyGUI::IntCoord coord(((int)tree % columns) * size, ((int)tree / columns) * size, size, size);
+			MyGUI::Widget* widget = MyGUI::Gui::getInstance().createWidget<MyGUI::Widget>("PanelEmpty", coord, MyGUI::Align::Default, "Overlapped");
+			mRoots.push_back(widget);
+
+			for (size_t depth = 1; depth < mDepth; ++depth)
+			{
+				// every level is inset by one pixel, deepest widget is found under most points
+				coord.set(1, 1, coord.width - 2, coord.height - 2);
+				widget = widget->createWidget<MyGUI::Widget>("PanelEmpty", coord, MyGUI::Align::Default);
+			}
+		}
+
+		size_t seed = 1;
+		mPoints.resize(mQueries);
+		for (size_t index = 0; index < mQueries; ++index)
+		{
+			int left = (int)(nextRandom(seed) % (size_t)viewSize.width);
+			int top = (int)(nextRandom(seed) % (size_t)viewSize.height);
+			mPoints[index].set(left, top);
+		}
+
+		MyGUI::DummyRenderManager::getInstance().drawOneFrame();
+	}
+
+	void WidgetPickingBenchmark::shutdown()
+	{
+		MyGUI::WidgetManager::getInstance().destroyWidgets(mRoots);
+		MyGUI::WidgetManager::getInstance()._deleteDelayWidgets();
+		mRoots.clear();
+		mPoints.clear();
+	}
+
+	void WidgetPickingBenchmark::run()
+	{
+		MyGUI::LayerManager& manager = MyGUI::LayerManager::getInstance();
+
+		mHits = 0;
+		for (std::vector<MyGUI::IntPoint>::const_iterator point = mPoints.begin(); point != mPoints.end(); ++point)
+		{
+			if (manager.getWidgetFromPoint(point->left, point->top) != nullptr)
+				mHits ++;
+		}
+	}
+
+	RenderBenchmark::RenderBenchmark(size_t _windows, bool _update) :
+		mWindows(_windows),
+		mUpdate(_update)
+	{
+	}
+
+	std::string RenderBenchmark::getName() const
+	{
+		return mUpdate ? "render_full" : "render_cached";
+	}
+
+	void RenderBenchmark::getParameters(VectorValue& _result) const
+	{
+		_result.push_back(PairValue("windows", mWindows));
+		_result.push_back(PairValue("widgets", mWindows * 3));
+	}
+
+	void RenderBenchmark::getCounters(VectorValue& _result) const
+	{
+		const MyGUI::DummyFrameStatistics& statistics = MyGUI::DummyRenderManager::getInstance().getDeviceStatistics();
+		_result.push_back(PairValue("draw_calls", statistics.drawCalls));
+		_result.push_back(PairValue("texture_binds", statistics.textureBinds));
+		_result.push_back(PairValue("vertices_rendered", statistics.verticesRendered));
+		_result.push_back(PairValue("vertices_uploaded", statistics.verticesUploaded));
+	}
+
+	void RenderBenchmark::initialise()
+	{
+		const MyGUI::IntSize& viewSize = MyGUI::RenderManager::getInstance().getViewSize();
+
+		for (size_t index = 0; index < mWindows; ++index)
+		{
+			MyGUI::IntCoord coord((int)(index * 7) % (viewSize.width - 200), (int)(index * 5) % (viewSize.height - 150), 200, 150);
+			MyGUI::Window* window = MyGUI::Gui::getInstance().createWidget<MyGUI::Window>("WindowCS", coord, MyGUI::Align::Default, "Overlapped");
+			window->setCaption(MyGUI::utility::toString("Window ", index));
+			window->createWidget<MyGUI::Button>("Button", MyGUI::IntCoord(10, 10, 80, 24), MyGUI::Align::Default)->setCaption("Button");
+			window->createWidget<MyGUI::EditBox>("EditBox", MyGUI::IntCoord(10, 40, 150, 24), MyGUI::Align::Default)->setCaption("Edit text");
+			mRoots.push_back(window);
+		}
+
+		// first frame creates all buffers and uploads all textures
+		MyGUI::DummyRenderManager::getInstance().drawOneFrame();
+	}
+
+	void RenderBenchmark::shutdown()
+	{
+		MyGUI::WidgetManager::getInstance().destroyWidgets(mRoots);
+		MyGUI::WidgetManager::getInstance()._deleteDelayWidgets();
+		mRoots.clear();
+	}
+
+	void RenderBenchmark::run()
+	{
+		MyGUI::DummyRenderManager::getInstance().drawOneFrame(mUpdate);
+	}
+
+	DataLookupBenchmark::DataLookupBenchmark(size_t _lookups) :
+		mLookups(_lookups),
+		mFound(0)
+	{
+	}
+
+	std::string DataLookupBenchmark::getName() const
+	{
+		return "data_lookup";
+	}
+
+	void DataLookupBenchmark::getParameters(VectorValue& _result) const
+	{
+		_result.push_back(PairValue("lookups", mLookups));
+		_result.push_back(PairValue("names", mNames.size()));
+	}
+
+	void DataLookupBenchmark::getCounters(VectorValue& _result) const
+	{
+		_result.push_back(PairValue("found", mFound));
+	}
+
+	void DataLookupBenchmark::initialise()
+	{
+		mNames = MyGUI::DataManager::getInstance().getDataListNames("*.xml");
+		const MyGUI::VectorString& images = MyGUI::DataManager::getInstance().getDataListNames("*.png");
+		mNames.insert(mNames.end(), images.begin(), images.end());
+
+		for (size_t index = 0; index < mNames.size(); index += 10)
+			mNames[index] = "Missing" + mNames[index];
+	}
+
+	void DataLookupBenchmark::run()
+	{
+		MyGUI::DataManager& manager = MyGUI::DataManager::getInstance();
+
+		mFound = 0;
+		if (mNames.empty())
+			return;
+
+		for (size_t index = 0; index < mLookups; ++index)
+		{
+			const std::string& name = mNames[index % mNames.size()];
+			if (manager.isDataExist(name) && !manager.getDataPath(name).empty())
+				mFound ++;
+		}
+	}
+
+	DataReadBenchmark::DataReadBenchmark(const std::string& _dataDir, bool _pack, bool _compress) :
+		mDataDir(_dataDir),
+		mPack(_pack),
+		mCompress(_compress),
+		mBytes(0)
+	{
+	}
+
+	std::string DataReadBenchmark::getName() const
+	{
+		if (!mPack)
+			return "data_read_files";
+		return mCompress ? "data_read_pack_lz4" : "data_read_pack";
+	}
+
+	void DataReadBenchmark::getParameters(VectorValue& _result) const
+	{
+		_result.push_back(PairValue("files", mNames.size()));
+	}
+
+	void DataReadBenchmark::getCounters(VectorValue& _result) const
+	{
+		_result.push_back(PairValue("bytes", mBytes));
+	}
+
+	void DataReadBenchmark::initialise()
+	{
+		MyGUI::DataManager& manager = MyGUI::DataManager::getInstance();
+
+		const char* masks[] = { "*.xml", "*.png", "*.ttf" };
+		for (size_t index = 0; index < sizeof(masks) / sizeof(masks[0]); ++index)
+		{
+			const MyGUI::VectorString& names = manager.getDataListNames(masks[index]);
+			mNames.insert(mNames.end(), names.begin(), names.end());
+		}
+
+		if (mPack)
+		{
+			MyGUI::VectorString files;
+			for (MyGUI::VectorString::const_iterator name = mNames.begin(); name != mNames.end(); ++name)
+				files.push_back(manager.getDataPath(*name));
+
+			std::string fileName = mDataDir + "/" + (mCompress ? CompressedPackFileName : PackFileName);
+			bool result = MyGUI::DataPack::create(fileName, files, mCompress) && mDataPack.open(fileName);
+			MYGUI_ASSERT(result, "Can't create pack '" << fileName << "'");
+		}
+	}
+
+	void DataReadBenchmark::run()
+	{
+		MyGUI::DataManager& manager = MyGUI::DataManager::getInstance();
+		std::vector<char> buffer;
+
+		mBytes = 0;
+		for (MyGUI::VectorString::const_iterator name = mNames.begin(); name != mNames.end(); ++name)
+		{
+			MyGUI::IDataStream* data = mPack ? mDataPack.getData(*name) : manager.getData(*name);
+			if (data == nullptr)
+				continue;
+
+			buffer.resize(data->size());
+			if (!buffer.empty())
+				mBytes += data->read(&buffer[0], buffer.size());
+
+			if (mPack)
+				delete data;
+			else
+				manager.freeData(data);
+		}
+	}
+
+	void DataReadBenchmark::shutdown()
+	{
+		mDataPack.close();
+		mNames.clear();
+	}
+
+} // namespace benchmark
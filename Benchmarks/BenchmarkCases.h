@@ -0,0 +1,269 @@
+/*
+ * This source file is part of MyGUI. For the latest info, see http://mygui.info/
+ * Distributed under the MIT License
+ * (See accompanying file COPYING.MIT or copy at http://opensource.org/licenses/MIT)
+ */
+
+#ifndef BENCHMARK_CASES_H_
+#define BENCHMARK_CASES_H_
+
+#include "Benchmark.h"
+#include "MyGUI.h"
+#include "MyGUI_TextView.h"
+#include "MyGUI_DataPack.h"
+
+namespace benchmark
+{
+
+	/** LayoutManager::loadLayout of generated layout, parsing included.
+		Child captions repeat in every window, so their text layouts are shared through cache.
+	*/
+	class LayoutLoadBenchmark :
+		public Benchmark
+	{
+	public:
+		LayoutLoadBenchmark(const std::string& _dataDir, size_t _windows);
+
+		virtual std::string getName() const;
+		virtual void getParameters(VectorValue& _result) const;
+		virtual void getCounters(VectorValue& _result) const;
+
+		virtual void initialise();
+		virtual void setUp();
+		virtual void run();
+		virtual void tearDown();
+
+	private:
+		std::string mDataDir;
+		size_t mWindows;
+		MyGUI::VectorWidgetPtr mWidgets;
+		size_t mRootWidgets;
+	};
+
+	/** ResourceManager::load of generated skin set, from xml or compiled with ResourceManager::compile */
+	class SkinLoadBenchmark :
+		public Benchmark
+	{
+	public:
+		SkinLoadBenchmark(const std::string& _dataDir, size_t _skins, bool _binary);
+
+		virtual std::string getName() const;
+		virtual void getParameters(VectorValue& _result) const;
+
+		virtual void initialise();
+		virtual void run();
+		virtual void tearDown();
+
+	private:
+		std::string mDataDir;
+		size_t mSkins;
+		bool mBinary;
+	};
+
+	/** xml::Document::open of generated skin set from memory, without creating resources.
+		Elements are allocated one by one or in document arena, document is text or saved with saveBinary.
+	*/
+	class XmlParseBenchmark :
+		public Benchmark
+	{
+	public:
+		XmlParseBenchmark(size_t _skins, bool _arena, bool _binary);
+
+		virtual std::string getName() const;
+		virtual void getParameters(VectorValue& _result) const;
+		virtual void getCounters(VectorValue& _result) const;
+
+		virtual void initialise();
+		virtual void run();
+
+	private:
+		size_t mSkins;
+		bool mArena;
+		bool mBinary;
+		std::string mText;
+		size_t mElements;
+	};
+
+	/** ResourceManager::load of generated true type font set, with glyphs rendered up front or on request */
+	class FontLoadBenchmark :
+		public Benchmark
+	{
+	public:
+		FontLoadBenchmark(const std::string& _dataDir, size_t _fonts, bool _lazy);
+
+		virtual std::string getName() const;
+		virtual void getParameters(VectorValue& _result) const;
+		virtual void getCounters(VectorValue& _result) const;
+
+		virtual void initialise();
+		virtual void run();
+		virtual void tearDown();
+
+	private:
+		std::string mDataDir;
+		size_t mFonts;
+		bool mLazy;
+		size_t mLoaded;
+	};
+
+	/** TextView::update on long text, with or without word wrap.
+		In append mode short line is appended to text before every run, so only last lines are layout again.
+	*/
+	class TextUpdateBenchmark :
+		public Benchmark
+	{
+	public:
+		TextUpdateBenchmark(size_t _length, int _maxWidth, bool _append);
+
+		virtual std::string getName() const;
+		virtual void getParameters(VectorValue& _result) const;
+		virtual void getCounters(VectorValue& _result) const;
+
+		virtual void initialise();
+		virtual void setUp();
+		virtual void run();
+
+	private:
+		size_t mLength;
+		int mMaxWidth;
+		bool mAppend;
+		MyGUI::UString mText;
+		MyGUI::IFont* mFont;
+		MyGUI::TextView mTextView;
+	};
+
+	/** Frame with read only multiline EditBox scrolled near end of long log, only visible lines are rendered */
+	class TextRenderBenchmark :
+		public Benchmark
+	{
+	public:
+		TextRenderBenchmark(size_t _lines);
+
+		virtual std::string getName() const;
+		virtual void getParameters(VectorValue& _result) const;
+		virtual void getCounters(VectorValue& _result) const;
+
+		virtual void initialise();
+		virtual void shutdown();
+		virtual void run();
+
+	private:
+		size_t mLines;
+		MyGUI::EditBox* mEdit;
+	};
+
+	/** Typing one character in the middle of long text of multiline EditBox, with undo history and frame */
+	class EditTypingBenchmark :
+		public Benchmark
+	{
+	public:
+		EditTypingBenchmark(size_t _length, bool _wordWrap);
+
+		virtual std::string getName() const;
+		virtual void getParameters(VectorValue& _result) const;
+		virtual void getCounters(VectorValue& _result) const;
+
+		virtual void initialise();
+		virtual void shutdown();
+		virtual void run();
+
+	private:
+		size_t mLength;
+		bool mWordWrap;
+		MyGUI::EditBox* mEdit;
+	};
+
+	/** LayerManager::getWidgetFromPoint on deep widget trees */
+	class WidgetPickingBenchmark :
+		public Benchmark
+	{
+	public:
+		WidgetPickingBenchmark(size_t _trees, size_t _depth, size_t _queries);
+
+		virtual std::string getName() const;
+		virtual void getParameters(VectorValue& _result) const;
+		virtual void getCounters(VectorValue& _result) const;
+
+		virtual void initialise();
+		virtual void shutdown();
+		virtual void run();
+
+	private:
+		size_t mTrees;
+		size_t mDepth;
+		size_t mQueries;
+		size_t mHits;
+		std::vector<MyGUI::IntPoint> mPoints;
+		MyGUI::VectorWidgetPtr mRoots;
+	};
+
+	/** Whole frame (LayerManager::renderToTarget) with thousands of widgets,
+		either regenerating all vertices or reusing cached ones
+	*/
+	class RenderBenchmark :
+		public Benchmark
+	{
+	public:
+		RenderBenchmark(size_t _windows, bool _update);
+
+		virtual std::string getName() const;
+		virtual void getParameters(VectorValue& _result) const;
+		virtual void getCounters(VectorValue& _result) const;
+
+		virtual void initialise();
+		virtual void shutdown();
+		virtual void run();
+
+	private:
+		size_t mWindows;
+		bool mUpdate;
+		MyGUI::VectorWidgetPtr mRoots;
+	};
+
+	/** DataManager::isDataExist and getDataPath of media files, every tenth name is missing */
+	class DataLookupBenchmark :
+		public Benchmark
+	{
+	public:
+		DataLookupBenchmark(size_t _lookups);
+
+		virtual std::string getName() const;
+		virtual void getParameters(VectorValue& _result) const;
+		virtual void getCounters(VectorValue& _result) const;
+
+		virtual void initialise();
+		virtual void run();
+
+	private:
+		size_t mLookups;
+		size_t mFound;
+		MyGUI::VectorString mNames;
+	};
+
+	/** Reading of all media files through DataManager or from DataPack, stored or compressed */
+	class DataReadBenchmark :
+		public Benchmark
+	{
+	public:
+		DataReadBenchmark(const std::string& _dataDir, bool _pack, bool _compress);
+
+		virtual std::string getName() const;
+		virtual void getParameters(VectorValue& _result) const;
+		virtual void getCounters(VectorValue& _result) const;
+
+		virtual void initialise();
+		virtual void run();
+		virtual void shutdown();
+
+	private:
+		std::string mDataDir;
+		bool mPack;
+		bool mCompress;
+		size_t mBytes;
+		MyGUI::VectorString mNames;
+		MyGUI::DataPack mDataPack;
+	};
+
+} // namespace benchmark
+
+#endif // BENCHMARK_CASES_H_
@@ -0,0 +1,210 @@
+/*
+ * This source file is part of MyGUI. For the latest info, see http://mygui.info/
+ * Distributed under the MIT License
+ * (See accompanying file COPYING.MIT or copy at http://opensource.org/licenses/MIT)
+ */
+
+#include "BenchmarkRunner.h"
+#include "MyGUI_Prerequest.h"
+#include "MyGUI_Timer.h"
+#include <algorithm>
+#include <iomanip>
+#include <iostream>
+
+namespace benchmark
+{
+
+	BenchmarkRunner::BenchmarkRunner() :
+		mIterations(10)
+	{
+	}
+
+	BenchmarkRunner::~BenchmarkRunner()
+	{
+		for (std::vector<Benchmark*>::iterator item = mBenchmarks.begin(); item != mBenchmarks.end(); ++item)
+			delete *item;
+		mBenchmarks.clear();
+	}
+
+	void BenchmarkRunner::addBenchmark(Benchmark* _benchmark)
+	{
+		mBenchmarks.push_back(_benchmark);
+	}
+
+	void BenchmarkRunner::setIterations(size_t _value)
+	{
+		mIterations = (std::max)(_value, (size_t)1);
+	}
+
+	void BenchmarkRunner::setFilter(const std::string& _value)
+	{
+		mFilter = _value;
+	}
+
+	void BenchmarkRunner::run()
+	{
+		mResults.clear();
+		for (std::vector<Benchmark*>::iterator item = mBenchmarks.begin(); item != mBenchmarks.end(); ++item)
+		{
+			if (!mFilter.empty() && (*item)->getName().find(mFilter) == std::string::npos)
+				continue;
+			runBenchmark(*item);
+		}
+	}
+
+	void BenchmarkRunner::runBenchmark(Benchmark* _benchmark)
+	{
+		std::cerr << "running " << _benchmark->getName() << std::endl;
+
+		Result result;
+		result.name = _benchmark->getName();
+		result.iterations = mIterations;
+		result.minimum = 0;
+		result.median = 0;
+		result.mean = 0;
+		result.maximum = 0;
+
+		// failed case is reported and the rest of suite still runs
+		bool initialised = false;
+		try
+		{
+			_benchmark->initialise();
+			initialised = true;
+
+			measure(_benchmark, result);
+
+			initialised = false;
+			_benchmark->shutdown();
+		}
+		catch (const std::exception& _e)
+		{
+			result.error = _e.what();
+			std::cerr << "failed " << result.name << ": " << result.error << std::endl;
+
+			if (initialised)
+			{
+				try
+				{
+					_benchmark->shutdown();
+				}
+				catch (const std::exception& _e)
+				{
+					std::cerr << "failed " << result.name << " shutdown: " << _e.what() << std::endl;
+				}
+			}
+		}
+
+		mResults.push_back(result);
+	}
+
+	void BenchmarkRunner::measure(Benchmark* _benchmark, Result& _result)
+	{
+		// warm up, caches and lazily created resources are not part of measurement
+		_benchmark->setUp();
+		_benchmark->run();
+		_benchmark->tearDown();
+
+		std::vector<double> times;
+		times.reserve(mIterations);
+		for (size_t index = 0; index < mIterations; ++index)
+		{
+			_benchmark->setUp();
+
+			unsigned long start = MyGUI::Timer::getCurrentMicroseconds();
+			_benchmark->run();
+			unsigned long finish = MyGUI::Timer::getCurrentMicroseconds();
+
+			times.push_back((double)(finish - start) / 1000.0);
+
+			_benchmark->tearDown();
+		}
+
+		_benchmark->getParameters(_result.parameters);
+		_benchmark->getCounters(_result.counters);
+
+		std::sort(times.begin(), times.end());
+		double total = 0;
+		for (std::vector<double>::const_iterator item = times.begin(); item != times.end(); ++item)
+			total += *item;
+
+		_result.minimum = times.front();
+		_result.maximum = times.back();
+		_result.mean = total / (double)times.size();
+		size_t middle = times.size() / 2;
+		_result.median = (times.size() % 2) != 0 ? times[middle] : (times[middle - 1] + times[middle]) * 0.5;
+	}
+
+	bool BenchmarkRunner::hasFailures() const
+	{
+		for (std::vector<Result>::const_iterator item = mResults.begin(); item != mResults.end(); ++item)
+		{
+			if (!item->error.empty())
+				return true;
+		}
+		return false;
+	}
+
+	void BenchmarkRunner::writeString(std::ostream& _stream, const std::string& _value)
+	{
+		_stream << "\"";
+		for (std::string::const_iterator item = _value.begin(); item != _value.end(); ++item)
+		{
+			if (*item == '"' || *item == '\\')
+				_stream << '\\' << *item;
+			else if (*item == '\n')
+				_stream << "\\n";
+			else if ((unsigned char)*item >= 0x20)
+				_stream << *item;
+		}
+		_stream << "\"";
+	}
+
+	void BenchmarkRunner::writeValues(std::ostream& _stream, const VectorValue& _values)
+	{
+		_stream << "{";
+		for (VectorValue::const_iterator item = _values.begin(); item != _values.end(); ++item)
+		{
+			if (item != _values.begin())
+				_stream << ", ";
+			_stream << "\"" << item->first << "\": " << item->second;
+		}
+		_stream << "}";
+	}
+
+	void BenchmarkRunner::writeJson(std::ostream& _stream) const
+	{
+		_stream << std::fixed << std::setprecision(4);
+		_stream << "{" << std::endl;
+		_stream << "\t\"format\": 1," << std::endl;
+		_stream << "\t\"platform\": \"Dummy\"," << std::endl;
+		_stream << "\t\"version\": \"" << MYGUI_VERSION_MAJOR << "." << MYGUI_VERSION_MINOR << "." << MYGUI_VERSION_PATCH << "\"," << std::endl;
+		_stream << "\t\"time_unit\": \"ms\"," << std::endl;
+		_stream << "\t\"benchmarks\": [" << std::endl;
+
+		for (std::vector<Result>::const_iterator item = mResults.begin(); item != mResults.end(); ++item)
+		{
+			_stream << "\t\t{" << std::endl;
+			_stream << "\t\t\t\"name\": \"" << item->name << "\"," << std::endl;
+			_stream << "\t\t\t\"iterations\": " << item->iterations << "," << std::endl;
+			_stream << "\t\t\t\"parameters\": ";
+			writeValues(_stream, item->parameters);
+			_stream << "," << std::endl;
+			_stream << "\t\t\t\"time\": {\"min\": " << item->minimum << ", \"median\": " << item->median
+				<< ", \"mean\": " << item->mean << ", \"max\": " << item->maximum << "}," << std::endl;
+			_stream << "\t\t\t\"counters\": ";
+			writeValues(_stream, item->counters);
+			if (!item->error.empty())
+			{
+				_stream << "," << std::endl;
+				_stream << "\t\t\t\"error\": ";
+				writeString(_stream, item->error);
+			}
+			_stream << std::endl;
+			_stream << "\t\t}" << (item + 1 != mResults.end() ? "," : "") << std::endl;
+		}
+
+		_stream << "\t]" << std::endl;
+		_stream << "}" << std::endl;
+	}
+
+} // namespace benchmark
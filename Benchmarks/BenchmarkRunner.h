@@ -0,0 +1,67 @@
+/*
+ * This source file is part of MyGUI. For the latest info, see http://mygui.info/
+ * Distributed under the MIT License
+ * (See accompanying file COPYING.MIT or copy at http://opensource.org/licenses/MIT)
+ */
+
+#ifndef BENCHMARK_RUNNER_H_
+#define BENCHMARK_RUNNER_H_
+
+#include "Benchmark.h"
+#include <ostream>
+
+namespace benchmark
+{
+
+	class BenchmarkRunner
+	{
+	public:
+		BenchmarkRunner();
+		~BenchmarkRunner();
+
+		/** Add benchmark, runner takes ownership */
+		void addBenchmark(Benchmark* _benchmark);
+
+		/** Number of timed iterations for every benchmark, one untimed warm up iteration is always done */
+		void setIterations(size_t _value);
+		/** Run only benchmarks which name contains _value */
+		void setFilter(const std::string& _value);
+
+		/** Run benchmarks, exception thrown by benchmark marks it as failed and next one is run */
+		void run();
+		/** True if any benchmark of last run failed */
+		bool hasFailures() const;
+
+		/** Write results in JSON, keys order and number format are stable between runs */
+		void writeJson(std::ostream& _stream) const;
+
+	private:
+		struct Result
+		{
+			std::string name;
+			size_t iterations;
+			VectorValue parameters;
+			VectorValue counters;
+			double minimum;
+			double median;
+			double mean;
+			double maximum;
+			// empty when benchmark succeeded
+			std::string error;
+		};
+
+		void runBenchmark(Benchmark* _benchmark);
+		void measure(Benchmark* _benchmark, Result& _result);
+		static void writeValues(std::ostream& _stream, const VectorValue& _values);
+		static void writeString(std::ostream& _stream, const std::string& _value);
+
+	private:
+		std::vector<Benchmark*> mBenchmarks;
+		std::vector<Result> mResults;
+		size_t mIterations;
+		std::string mFilter;
+	};
+
+} // namespace benchmark
+
+#endif // BENCHMARK_RUNNER_H_
@@ -0,0 +1,142 @@
+/*
+ * This source file is part of MyGUI. For the latest info, see http://mygui.info/
+ * Distributed under the MIT License
+ * (See accompanying file COPYING.MIT or copy at http://opensource.org/licenses/MIT)
+ */
+
+#include "BenchmarkRunner.h"
+#include "BenchmarkCases.h"
+#include "MyGUI_DummyPlatform.h"
+#include <fstream>
+#include <iostream>
+#include <cstdlib>
+
+namespace
+{
+
+	void printUsage(const char* _name)
+	{
+		std::cerr << "usage: " << _name << " [--media <dir>] [--data <dir>] [--iterations <count>] [--filter <name>] [--output <file.json>] [--trace <file.json>]" << std::endl;
+	}
+
+} // namespace
+
+int main(int argc, char* argv[])
+{
+	std::string mediaDir = MYGUI_BENCHMARKS_MEDIA_DIR;
+	std::string dataDir = MYGUI_BENCHMARKS_DATA_DIR;
+	std::string outputFile;
+	std::string traceFile;
+	std::string filter;
+	size_t iterations = 10;
+
+	for (int index = 1; index < argc; ++index)
+	{
+		std::string key = argv[index];
+		if (index + 1 >= argc)
+		{
+			printUsage(argv[0]);
+			return 1;
+		}
+
+		std::string value = argv[++index];
+		if (key == "--media")
+			mediaDir = value;
+		else if (key == "--data")
+			dataDir = value;
+		else if (key == "--iterations")
+			iterations = (size_t)std::atoi(value.c_str());
+		else if (key == "--filter")
+			filter = value;
+		else if (key == "--output")
+			outputFile = value;
+		else if (key == "--trace")
+			traceFile = value;
+		else
+		{
+			printUsage(argv[0]);
+			return 1;
+		}
+	}
+
+	MyGUI::DummyPlatform* platform = new MyGUI::DummyPlatform();
+	platform->initialise(dataDir + "/MyGUI_Benchmarks.log");
+	platform->getDataManagerPtr()->addResourceLocation(mediaDir, false);
+	platform->getDataManagerPtr()->addResourceLocation(dataDir, false);
+	platform->getRenderManagerPtr()->setViewSize(1024, 768);
+
+	// zones are recorded only when engine is built with MYGUI_ENABLE_PROFILING
+	MyGUI::Profiler* profiler = nullptr;
+	if (!traceFile.empty())
+		profiler = new MyGUI::Profiler(1024 * 1024);
+
+	MyGUI::Gui* gui = new MyGUI::Gui();
+	gui->initialise("MyGUI_Core.xml");
+
+	int result = 0;
+	{
+		benchmark::BenchmarkRunner runner;
+		runner.setIterations(iterations);
+		runner.setFilter(filter);
+
+		runner.addBenchmark(new benchmark::LayoutLoadBenchmark(dataDir, 100));
+		runner.addBenchmark(new benchmark::SkinLoadBenchmark(dataDir, 2000, false));
+		runner.addBenchmark(new benchmark::SkinLoadBenchmark(dataDir, 2000, true));
+		runner.addBenchmark(new benchmark::XmlParseBenchmark(2000, false, false));
+		runner.addBenchmark(new benchmark::XmlParseBenchmark(2000, true, false));
+		runner.addBenchmark(new benchmark::XmlParseBenchmark(2000, true, true));
+		runner.addBenchmark(new benchmark::FontLoadBenchmark(dataDir, 8, false));
+		runner.addBenchmark(new benchmark::FontLoadBenchmark(dataDir, 8, true));
+		runner.addBenchmark(new benchmark::TextUpdateBenchmark(65536, -1, false));
+		runner.addBenchmark(new benchmark::TextUpdateBenchmark(65536, 600, false));
+		runner.addBenchmark(new benchmark::TextUpdateBenchmark(65536, -1, true));
+		runner.addBenchmark(new benchmark::TextUpdateBenchmark(65536, 600, true));
+		runner.addBenchmark(new benchmark::TextRenderBenchmark(10000));
+		runner.addBenchmark(new benchmark::EditTypingBenchmark(1024 * 1024, false));
+		runner.addBenchmark(new benchmark::EditTypingBenchmark(1024 * 1024, true));
+		runner.addBenchmark(new benchmark::WidgetPickingBenchmark(16, 64, 10000));
+		runner.addBenchmark(new benchmark::RenderBenchmark(1000, true));
+		runner.addBenchmark(new benchmark::RenderBenchmark(1000, false));
+		runner.addBenchmark(new benchmark::DataLookupBenchmark(1000));
+		runner.addBenchmark(new benchmark::DataReadBenchmark(dataDir, false, false));
+		runner.addBenchmark(new benchmark::DataReadBenchmark(dataDir, true, false));
+		runner.addBenchmark(new benchmark::DataReadBenchmark(dataDir, true, true));
+
+		runner.run();
+		if (runner.hasFailures())
+			result = 1;
+
+		if (outputFile.empty())
+		{
+			runner.writeJson(std::cout);
+		}
+		else
+		{
+			std::ofstream stream(outputFile.c_str());
+			if (!stream.is_open())
+			{
+				std::cerr << "can't write '" << outputFile << "'" << std::endl;
+				result = 1;
+			}
+			else
+			{
+				runner.writeJson(stream);
+			}
+		}
+	}
+
+	gui->shutdown();
+	delete gui;
+
+	if (profiler != nullptr)
+	{
+		if (!profiler->saveChromeTrace(traceFile))
+			result = 1;
+		delete profiler;
+	}
+
+	platform->shutdown();
+	delete platform;
+
+	return result;
+}
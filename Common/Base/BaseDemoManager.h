@@ -106,6 +106,11 @@ namespace base
 					MyGUI::MapString statistic = getStatistic();
 					for (MyGUI::MapString::const_iterator info = statistic.begin(); info != statistic.end(); info ++)
 						mInfo->change((*info).first, (*info).second);
+
+					const MyGUI::FrameStatistics& frame = MyGUI::RenderManager::getInstance().getFrameStatistics();
+					mInfo->change("Batches", frame.drawCalls);
+					mInfo->change("Vertices regenerated", frame.verticesRegenerated);
+					mInfo->change("Vertices reused", frame.verticesReused);
 					mInfo->update();
 				}
 			}
@@ -1,6 +1,7 @@
 // WARNING: copy of this file is used in OpenGL3 platform, modify both files if possible
 #include "Precompiled.h"
 #include "BaseManager.h"
+#include "MyGUI_DataStreamHolder.h"
 
 #include <SDL_image.h>
 #include "GL/glew.h"
@@ -402,12 +403,22 @@ namespace base
 
 	void* BaseManager::loadImage(int& _width, int& _height, MyGUI::PixelFormat& _format, const std::string& _filename)
 	{
-		std::string fullname = MyGUI::OpenGLDataManager::getInstance().getDataPath(_filename);
+		// image is read through DataManager, it can be not a file on disk
+		MyGUI::DataStreamHolder data(MyGUI::DataManager::getInstance().getData(_filename));
+		MYGUI_ASSERT(data.getData() != nullptr && data.getData()->size() != 0, "Failed to load image: " + _filename);
+
+		std::vector<char> buffer(data.getData()->size());
+		size_t size = data.getData()->read(&buffer[0], buffer.size());
+
+		// type is taken from extension like IMG_Load does, some formats can't be detected by content
+		size_t dot = _filename.find_last_of('.');
+		std::string type = dot == std::string::npos ? std::string() : _filename.substr(dot + 1);
+
 		void* result = nullptr;
 		SDL_Surface *image = nullptr;
 		SDL_Surface *cvtImage = nullptr;		// converted surface with RGBA/RGB pixel format
-		image = IMG_Load(fullname.c_str());
-		MYGUI_ASSERT(image != nullptr, "Failed to load image: " + fullname);
+		image = IMG_LoadTyped_RW(SDL_RWFromConstMem(&buffer[0], (int)size), 1, type.c_str());
+		MYGUI_ASSERT(image != nullptr, "Failed to load image: " + _filename);
 
 		_width = image->w;
 		_height = image->h;
@@ -0,0 +1,286 @@
+/*
+ * This source file is part of MyGUI. For the latest info, see http://mygui.info/
+ * Distributed under the MIT License
+ * (See accompanying file COPYING.MIT or copy at http://opensource.org/licenses/MIT)
+ */
+
+#ifndef DATA_FILE_INDEX_H_
+#define DATA_FILE_INDEX_H_
+
+#include "FileSystemInfo/FileSystemInfo.h"
+#include <sys/types.h>
+#include <sys/stat.h>
+#include <ctime>
+
+#ifndef MYGUI_NO_CXX11
+#	include <unordered_map>
+#else
+#	include <map>
+#endif
+
+namespace common
+{
+
+	/** Index of files in resource locations of data manager.
+		Locations are scanned once when added, then files are found by name without scanning folders.
+		Names with folders or brackets are searched by scanning, like before indexing.
+		When exact name is not found, folders are checked for changes first, so files added later
+		are still found. Removed or renamed files are noticed only with setCheckChanges(true).
+	*/
+	class DataFileIndex
+	{
+	public:
+		DataFileIndex() :
+			mCheckChanges(false)
+		{
+		}
+
+		void addLocation(const std::wstring& _folder, bool _recursive)
+		{
+			Location location;
+			location.folder = _folder;
+			location.recursive = _recursive;
+			mLocations.push_back(location);
+
+			addFolder(_folder, _recursive);
+		}
+
+		/** Find files that match mask in all locations, same as scanFolder for each location. */
+		void scan(VectorWString& _result, const std::wstring& _mask, bool _fullpath)
+		{
+			if (!isIndexed(_mask))
+			{
+				for (VectorLocation::const_iterator item = mLocations.begin(); item != mLocations.end(); ++item)
+					scanFolder(_result, item->folder, item->recursive, _mask, _fullpath);
+				return;
+			}
+
+			if (mCheckChanges)
+				checkChanges();
+
+			if (_mask.find_first_of(L"*?") == std::wstring::npos)
+			{
+				// точное имя, ищем в индексе
+				MapFile::const_iterator item = mFiles.find(getKey(_mask));
+				if (item == mFiles.end())
+				{
+					// файл мог появиться после индексации
+					if (mCheckChanges || !checkChanges())
+						return;
+
+					item = mFiles.find(getKey(_mask));
+					if (item == mFiles.end())
+						return;
+				}
+
+				for (std::vector<size_t>::const_iterator index = item->second.begin(); index != item->second.end(); ++index)
+				{
+					const FileItem& file = mItems[*index];
+					_result.push_back(_fullpath ? file.path : file.name);
+				}
+			}
+			else
+			{
+				std::wstring mask = getKey(_mask);
+#if MYGUI_PLATFORM == MYGUI_PLATFORM_WIN32
+				// для системы это все файлы, даже без расширения
+				if (mask == L"*.*")
+					mask = L"*";
+#endif
+				for (VectorFileItem::const_iterator item = mItems.begin(); item != mItems.end(); ++item)
+				{
+					if (isMatch(getKey(item->name).c_str(), mask.c_str()))
+						_result.push_back(_fullpath ? item->path : item->name);
+				}
+			}
+		}
+
+		/** Enable or disable checking of locations before each search. When enabled,
+			modification time of every indexed folder is checked and index is made again if files were
+			added, removed or renamed. When disabled, folders are checked only if exact name is not found.
+		*/
+		void setCheckChanges(bool _value)
+		{
+			mCheckChanges = _value;
+		}
+
+		bool getCheckChanges() const
+		{
+			return mCheckChanges;
+		}
+
+		/** Make index again if any indexed folder was changed.
+			@return true if index was made again.
+		*/
+		bool checkChanges()
+		{
+			for (VectorFolder::const_iterator item = mFolders.begin(); item != mFolders.end(); ++item)
+			{
+				// time is in seconds, folder changed in second of indexing could be changed after it
+				if (getModifyTime(item->folder) != item->modifyTime || item->modifyTime >= item->indexTime)
+				{
+					update();
+					return true;
+				}
+			}
+			return false;
+		}
+
+		/** Make index of all locations again. */
+		void update()
+		{
+			mItems.clear();
+			mFiles.clear();
+			mFolders.clear();
+
+			for (VectorLocation::const_iterator item = mLocations.begin(); item != mLocations.end(); ++item)
+				addFolder(item->folder, item->recursive);
+		}
+
+	private:
+		void addFolder(const std::wstring& _folder, bool _recursive)
+		{
+			// пути такие же как у scanFolder
+			std::wstring folder = _folder;
+			if (!folder.empty() && *folder.rbegin() != '/' && *folder.rbegin() != '\\') folder += L"/";
+
+			FolderItem folderItem;
+			folderItem.folder = folder;
+			folderItem.indexTime = time(nullptr);
+			folderItem.modifyTime = getModifyTime(folder);
+			mFolders.push_back(folderItem);
+
+			VectorFileInfo result;
+			getSystemFileList(result, folder, L"*");
+
+			// сначала файлы, папки отсортированы после них
+			for (VectorFileInfo::const_iterator item = result.begin(); item != result.end(); ++item)
+			{
+				if (item->folder)
+					continue;
+
+				FileItem file;
+				file.name = item->name;
+				file.path = folder + item->name;
+				mFiles[getKey(item->name)].push_back(mItems.size());
+				mItems.push_back(file);
+			}
+
+			if (_recursive)
+			{
+				for (VectorFileInfo::const_iterator item = result.begin(); item != result.end(); ++item)
+				{
+					if (!item->folder
+						|| item->name == L".."
+						|| item->name == L".") continue;
+					addFolder(folder + item->name, _recursive);
+				}
+			}
+		}
+
+		// имена с папками и наборами символов ищутся системой
+		static bool isIndexed(const std::wstring& _mask)
+		{
+			return !_mask.empty() && _mask.find_first_of(L"/\\[") == std::wstring::npos;
+		}
+
+		static std::wstring getKey(const std::wstring& _name)
+		{
+#if MYGUI_PLATFORM == MYGUI_PLATFORM_WIN32
+			return toLower(_name);
+#else
+			return _name;
+#endif
+		}
+
+		static bool isMatch(const wchar_t* _name, const wchar_t* _mask)
+		{
+			// позиция последней звездочки, с нее продолжаем при несовпадении
+			const wchar_t* star = nullptr;
+			const wchar_t* starName = nullptr;
+			while (*_name != 0)
+			{
+				if (*_mask == '*')
+				{
+					star = ++_mask;
+					starName = _name;
+				}
+				else if (*_mask == '?' || *_mask == *_name)
+				{
+					++_mask;
+					++_name;
+				}
+				else if (star != nullptr)
+				{
+					_mask = star;
+					_name = ++starName;
+				}
+				else
+				{
+					return false;
+				}
+			}
+
+			while (*_mask == '*')
+				++_mask;
+			return *_mask == 0;
+		}
+
+		static time_t getModifyTime(const std::wstring& _folder)
+		{
+#if MYGUI_PLATFORM == MYGUI_PLATFORM_WIN32
+			// система не принимает папку с разделителем в конце
+			std::wstring folder = _folder;
+			if (folder.size() > 1 && (*folder.rbegin() == '/' || *folder.rbegin() == '\\'))
+				folder.erase(folder.size() - 1);
+			struct _stat info;
+			if (_wstat(folder.c_str(), &info) != 0)
+				return 0;
+#else
+			struct stat info;
+			if (stat(MyGUI::UString(_folder).asUTF8_c_str(), &info) != 0)
+				return 0;
+#endif
+			return info.st_mtime;
+		}
+
+	private:
+		struct Location
+		{
+			std::wstring folder;
+			bool recursive;
+		};
+		typedef std::vector<Location> VectorLocation;
+		VectorLocation mLocations;
+
+		struct FileItem
+		{
+			std::wstring name;
+			std::wstring path;
+		};
+		// файлы в порядке обхода папок
+		typedef std::vector<FileItem> VectorFileItem;
+		VectorFileItem mItems;
+
+#ifdef MYGUI_NO_CXX11
+		typedef std::map<std::wstring, std::vector<size_t> > MapFile;
+#else
+		typedef std::unordered_map<std::wstring, std::vector<size_t> > MapFile;
+#endif
+		MapFile mFiles;
+
+		struct FolderItem
+		{
+			std::wstring folder;
+			time_t modifyTime;
+			time_t indexTime;
+		};
+		typedef std::vector<FolderItem> VectorFolder;
+		VectorFolder mFolders;
+
+		bool mCheckChanges;
+	};
+
+}
+
+#endif // DATA_FILE_INDEX_H_
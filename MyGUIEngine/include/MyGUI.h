@@ -37,6 +37,7 @@
 #include "MyGUI_ClipboardManager.h"
 #include "MyGUI_LayerManager.h"
 #include "MyGUI_LogManager.h"
+#include "MyGUI_Profiler.h"
 #include "MyGUI_SkinManager.h"
 #include "MyGUI_WidgetManager.h"
 #include "MyGUI_LayoutManager.h"
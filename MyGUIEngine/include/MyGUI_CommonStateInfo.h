@@ -40,9 +40,8 @@ namespace MyGUI
 				texture = LanguageManager::getInstance().replaceTags(texture);
 			}
 
-			const IntSize& size = texture_utility::getTextureSize(texture);
 			const IntCoord& coord = IntCoord::parse(_node->findAttribute("offset"));
-			mRect = CoordConverter::convertTextureCoord(coord, size);
+			mRect = texture_utility::getTextureRect(texture, coord);
 		}
 
 	private:
@@ -94,9 +93,8 @@ namespace MyGUI
 				texture = LanguageManager::getInstance().replaceTags(texture);
 			}
 
-			const IntSize& size = texture_utility::getTextureSize(texture);
 			const IntCoord& coord = IntCoord::parse(_node->findAttribute("offset"));
-			mRect = CoordConverter::convertTextureCoord(coord, size);
+			mRect = texture_utility::getTextureRect(texture, coord);
 
 			xml::ElementEnumerator prop = _node->getElementEnumerator();
 			while (prop.next("Property"))
@@ -164,9 +162,8 @@ namespace MyGUI
 				texture = LanguageManager::getInstance().replaceTags(texture);
 			}
 
-			const IntSize& size = texture_utility::getTextureSize(texture);
 			const IntCoord& coord = IntCoord::parse(_node->findAttribute("offset"));
-			mRect = CoordConverter::convertTextureCoord(coord, size);
+			mRect = texture_utility::getTextureRect(texture, coord);
 		}
 
 	private:
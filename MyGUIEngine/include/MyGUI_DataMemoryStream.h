@@ -13,6 +13,7 @@
 namespace MyGUI
 {
 
+	/** Stream of data in memory, data is read in place and is not copied or owned by stream */
 	class MYGUI_EXPORT DataMemoryStream :
 		public IDataStream
 	{
@@ -26,13 +27,11 @@ namespace MyGUI
 		virtual void readline(std::string& _source, Char _delim);
 		virtual size_t read(void* _buf, size_t _count);
 
-	private:
-		void prepareStream();
-
 	protected:
 		unsigned char* mData;
 		size_t mSize;
-		std::stringstream* mStream;
+		// позиция чтения
+		size_t mPosition;
 	};
 
 } // namespace MyGUI
@@ -0,0 +1,93 @@
+/*
+ * This source file is part of MyGUI. For the latest info, see http://mygui.info/
+ * Distributed under the MIT License
+ * (See accompanying file COPYING.MIT or copy at http://opensource.org/licenses/MIT)
+ */
+
+#ifndef MYGUI_DATA_PACK_H_
+#define MYGUI_DATA_PACK_H_
+
+#include "MyGUI_Prerequest.h"
+#include "MyGUI_Types.h"
+#include "MyGUI_IDataStream.h"
+
+#ifndef MYGUI_NO_CXX11
+#	include <unordered_map>
+#else
+#	include <map>
+#endif
+
+namespace MyGUI
+{
+
+	/** Pack of many data files in one file.
+		Entries are stored as is or compressed with LZ4 and are found by file name through directory
+		at the end of pack. Pack file is mapped to memory, stored entries are read in place without copying.
+	*/
+	class MYGUI_EXPORT DataPack
+	{
+	public:
+		DataPack();
+		~DataPack();
+
+		/** Open pack file, file name in utf8 */
+		bool open(const std::string& _file);
+		/** Close pack file, streams of pack must be deleted before */
+		void close();
+
+		/** Get pack file name */
+		const std::string& getFileName() const;
+
+		/** Get stream of entry or nullptr if there is no such entry, stream must be deleted by caller.
+			Stored entries are read from mapped pack, compressed ones are unpacked to stream own buffer.
+		*/
+		IDataStream* getData(const std::string& _name) const;
+
+		/** Is entry with specified name exist */
+		bool isDataExist(const std::string& _name) const;
+
+		/** Add names of entries that match pattern ('*' and '?' wildcards), in pack order */
+		void getDataListNames(const std::string& _pattern, VectorString& _result) const;
+
+		/** Get number of entries */
+		size_t getCount() const;
+
+		/** Write pack file from files, entries are named by file names without folders.
+			@param _file Pack file name.
+			@param _sources Files to pack, if several files have same name first one is used.
+			@param _compress Compress entries with LZ4, entries that become no smaller are stored as is.
+		*/
+		static bool create(const std::string& _file, const VectorString& _sources, bool _compress);
+
+	private:
+		struct Entry
+		{
+			std::string name;
+			uint8 method;
+			size_t offset;
+			size_t packedSize;
+			size_t size;
+		};
+		typedef std::vector<Entry> VectorEntry;
+
+		bool readDirectory();
+
+	private:
+		std::string mFileName;
+		const uint8* mData;
+		size_t mSize;
+		// система держит отображение файла
+		void* mHandle;
+
+		VectorEntry mEntries;
+#ifdef MYGUI_NO_CXX11
+		typedef std::map<std::string, size_t> MapEntry;
+#else
+		typedef std::unordered_map<std::string, size_t> MapEntry;
+#endif
+		MapEntry mEntryNames;
+	};
+
+} // namespace MyGUI
+
+#endif // MYGUI_DATA_PACK_H_
@@ -112,9 +112,14 @@ namespace MyGUI
 
 		virtual const VectorLineInfo& getLineInfo() const;
 
+	protected:
+		// layout of caption, shared from cache or own
+		const TextView& getTextView() const;
+
 	private:
 		void _setTextColour(const Colour& _value);
 		void checkVertexSize();
+		void releaseCachedTextView();
 		unsigned int getMixedNativeAlpha(float secondAlpha);
 
 		void drawQuad(
@@ -141,6 +146,8 @@ namespace MyGUI
 		IntCoord mCurrentCoord;
 
 		UString mCaption;
+		// length of longest line of caption, lines after word wrap are not longer
+		size_t mCaptionLineLength;
 		bool mTextOutDate;
 		Align mTextAlign;
 
@@ -173,7 +180,10 @@ namespace MyGUI
 		bool mManualColour;
 		int mOldWidth;
 
+		// own layout, used for texts that are too long for layout cache
 		TextView mTextView;
+		// layout from FontManager text layout cache, or nullptr if own layout is used
+		const TextView* mCachedTextView;
 	};
 
 } // namespace MyGUI
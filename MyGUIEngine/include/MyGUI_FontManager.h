@@ -13,6 +13,7 @@
 #include "MyGUI_Singleton.h"
 #include "MyGUI_XmlDocument.h"
 #include "MyGUI_ResourceManager.h"
+#include "MyGUI_TextLayoutCache.h"
 #include "MyGUI_BackwardCompatibility.h"
 
 namespace MyGUI
@@ -40,6 +41,9 @@ namespace MyGUI
 		/** Get font resource */
 		IFont* getByName(const std::string& _name) const;
 
+		/** Get cache of text layouts shared by text subwidgets */
+		TextLayoutCache& getTextLayoutCache();
+
 	private:
 		void _load(xml::ElementPtr _node, const std::string& _file, Version _version);
 
@@ -50,6 +54,8 @@ namespace MyGUI
 		std::string mXmlFontTagName;
 		std::string mXmlPropertyTagName;
 		std::string mXmlDefaultFontValue;
+
+		TextLayoutCache mTextLayoutCache;
 	};
 
 } // namespace MyGUI
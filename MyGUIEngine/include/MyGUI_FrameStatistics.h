@@ -0,0 +1,96 @@
+/*
+ * This source file is part of MyGUI. For the latest info, see http://mygui.info/
+ * Distributed under the MIT License
+ * (See accompanying file COPYING.MIT or copy at http://opensource.org/licenses/MIT)
+ */
+
+#ifndef MYGUI_FRAME_STATISTICS_H_
+#define MYGUI_FRAME_STATISTICS_H_
+
+#include "MyGUI_Prerequest.h"
+#include <string>
+#include <vector>
+
+namespace MyGUI
+{
+
+	struct MYGUI_EXPORT LayerStatistics
+	{
+		LayerStatistics() :
+			batches(0)
+		{
+		}
+
+		LayerStatistics(const std::string& _name, size_t _batches) :
+			name(_name),
+			batches(_batches)
+		{
+		}
+
+		std::string name;
+		size_t batches;
+	};
+
+	typedef std::vector<LayerStatistics> VectorLayerStatistics;
+
+	/** Counters collected by engine during one frame.
+		Frame starts with RenderManager::onFrameEvent, so anything happened between
+		two frame events (input, widgets creation, rendering) belongs to one frame.
+	*/
+	struct MYGUI_EXPORT FrameStatistics
+	{
+		FrameStatistics();
+
+		void clear();
+
+		/** Add batches rendered for layer, layer rendered more than once per frame is summed */
+		void addLayerBatches(const std::string& _name, size_t _batches);
+
+		/** Batches (render items) submitted to render targets */
+		size_t drawCalls;
+		/** Submitted batches with texture different from previous batch */
+		size_t textureBinds;
+		/** Batches submitted for every layer, in render order */
+		VectorLayerStatistics layers;
+
+		/** Vertices generated by subwidgets */
+		size_t verticesRegenerated;
+		/** Vertices submitted from buffers without regeneration */
+		size_t verticesReused;
+		/** Vertex buffer allocations and reallocations */
+		size_t vertexBufferReallocations;
+
+		size_t widgetsCreated;
+		size_t widgetsDestroyed;
+		/** TextView::update calls, i.e. text layouts */
+		size_t textViewUpdates;
+		/** Text layouts found in TextLayoutCache instead of laying out text */
+		size_t textLayoutCacheHits;
+
+		/** Time of phases in microseconds, collected only when RenderManager::setFrameTiming enabled.
+			Frame event time includes controllers.
+		*/
+		size_t frameEventTime;
+		size_t controllersTime;
+		size_t inputPickingTime;
+		size_t vertexGenerationTime;
+		size_t submissionTime;
+	};
+
+	/** Adds time between construction and destruction to phase of current frame statistics.
+		Does nothing when frame timing is disabled.
+	*/
+	class MYGUI_EXPORT FrameTimingScope
+	{
+	public:
+		explicit FrameTimingScope(size_t FrameStatistics::* _phase);
+		~FrameTimingScope();
+
+	private:
+		size_t* mTime;
+		unsigned long mStart;
+	};
+
+} // namespace MyGUI
+
+#endif // MYGUI_FRAME_STATISTICS_H_
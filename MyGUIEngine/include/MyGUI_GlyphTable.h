@@ -0,0 +1,70 @@
+/*
+ * This source file is part of MyGUI. For the latest info, see http://mygui.info/
+ * Distributed under the MIT License
+ * (See accompanying file COPYING.MIT or copy at http://opensource.org/licenses/MIT)
+ */
+
+#ifndef MYGUI_GLYPH_TABLE_H_
+#define MYGUI_GLYPH_TABLE_H_
+
+#include "MyGUI_Prerequest.h"
+#include "MyGUI_FontData.h"
+#include <map>
+#include <vector>
+
+namespace MyGUI
+{
+
+	/** Index of glyphs by code point for fonts.
+		Unicode code points are looked up directly in pages of 256 glyphs, so lookup takes one range check and two loads.
+		Other code points (like special glyphs FontCodeType::Cursor) are kept in map. Glyphs are not owned by table.
+	*/
+	class MYGUI_EXPORT GlyphTable
+	{
+	public:
+		GlyphTable();
+		~GlyphTable();
+
+		/** Get glyph for code point, or nullptr if there is no glyph */
+		GlyphInfo* find(Char _codePoint) const
+		{
+			size_t page = _codePoint >> PageBits;
+			if (page < mPages.size())
+				return mPages[page]->glyphs[_codePoint & PageMask];
+			return findOther(_codePoint);
+		}
+
+		/** Set glyph for code point, replacing previous one */
+		void insert(Char _codePoint, GlyphInfo* _info);
+		/** Remove glyph for code point */
+		void erase(Char _codePoint);
+		/** Remove all glyphs */
+		void clear();
+
+	private:
+		GlyphTable(const GlyphTable&);
+		GlyphTable& operator = (const GlyphTable&);
+
+		GlyphInfo* findOther(Char _codePoint) const;
+
+		enum
+		{
+			PageBits = 8,
+			PageSize = 1 << PageBits,
+			PageMask = PageSize - 1
+		};
+
+		struct Page
+		{
+			GlyphInfo* glyphs[PageSize];
+		};
+
+		// pages up to the last used one, pages without glyphs point to mEmptyPage
+		std::vector<Page*> mPages;
+		Page mEmptyPage;
+		std::map<Char, GlyphInfo*> mOther;
+	};
+
+} // namespace MyGUI
+
+#endif // MYGUI_GLYPH_TABLE_H_
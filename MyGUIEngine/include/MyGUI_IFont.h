@@ -31,6 +31,18 @@ namespace MyGUI
 		virtual ITexture* getTextureFont() = 0;
 
 		virtual int getDefaultHeight() = 0;
+
+		// Returns whether getKerning() may return anything but zero, so that text layout can skip kerning lookups.
+		virtual bool hasKerning()
+		{
+			return false;
+		}
+
+		// Returns the adjustment of the distance between the glyphs of the specified code points at the default height, in pixels.
+		virtual float getKerning(Char _left, Char _right)
+		{
+			return 0.0f;
+		}
 	};
 
 } // namespace MyGUI
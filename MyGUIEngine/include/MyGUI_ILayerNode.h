@@ -19,6 +19,7 @@ namespace MyGUI
 	class ILayer;
 	class ILayerItem;
 	class ILayerNode;
+	class ISubWidget;
 
 	class RenderItem;
 
@@ -63,6 +64,11 @@ namespace MyGUI
 		virtual RenderItem* addToRenderItem(ITexture* _texture, bool _firstQueue, bool _separate) = 0;
 		// необходимо обновление нода
 		virtual void outOfDate(RenderItem* _item) = 0;
+		// необходимо обновление только вершин одного саб виджета
+		virtual void outOfDate(RenderItem* _item, ISubWidget* _drawItem)
+		{
+			outOfDate(_item);
+		}
 
 		// возвращает виджет по позиции
 		virtual ILayerItem* getLayerItemByPoint(int _left, int _top) const = 0;
@@ -8,6 +8,7 @@
 #define MYGUI_I_TEXTURE_H_
 
 #include "MyGUI_Prerequest.h"
+#include "MyGUI_Types.h"
 #include "MyGUI_IRenderTarget.h"
 #include "MyGUI_RenderFormat.h"
 #include <string>
@@ -43,6 +44,23 @@ namespace MyGUI
 		virtual void unlock() = 0;
 		virtual bool isLocked() = 0;
 
+		/** Update rectangle of texture without touching the rest of it's content.
+			@param _coord Rectangle to update, in pixels.
+			@param _data Pixels of whole texture in texture format, only rectangle is read.
+			@return false if partial update is not supported, in that case whole texture is updated with lock().
+		*/
+		virtual bool updateRegion(const IntCoord& _coord, const void* _data)
+		{
+			return false;
+		}
+
+		/** Render texture with built-in shader of render system, empty name selects default shader.
+			@see RenderManager::isShaderSupported
+		*/
+		virtual void setShader(const std::string& _shaderName)
+		{
+		}
+
 		virtual int getWidth() = 0;
 		virtual int getHeight() = 0;
 
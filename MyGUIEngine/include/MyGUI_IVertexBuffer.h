@@ -23,6 +23,24 @@ namespace MyGUI
 
 		virtual Vertex* lock() = 0;
 		virtual void unlock() = 0;
+
+		/** Lock part of buffer for writing without discarding the rest of it's content.
+			@return Pointer to the first vertex of the range or nullptr if partial lock is not supported,
+				in that case whole buffer is updated with lock().
+		*/
+		virtual Vertex* lockRange(size_t _start, size_t _count)
+		{
+			return nullptr;
+		}
+
+		/** Called every frame buffer is rendered.
+			@return true if buffer is much bigger than needed for a long time and have to be refilled
+				with lock(), that reallocates it with smaller size.
+		*/
+		virtual bool checkShrink()
+		{
+			return false;
+		}
 	};
 
 } // namespace MyGUI
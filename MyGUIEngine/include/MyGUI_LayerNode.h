@@ -58,6 +58,7 @@ namespace MyGUI
 		virtual RenderItem* addToRenderItem(ITexture* _texture, bool _firstQueue, bool _manualRender);
 		// необходимо обновление нода
 		virtual void outOfDate(RenderItem* _item);
+		virtual void outOfDate(RenderItem* _item, ISubWidget* _drawItem);
 
 		// возвращает виджет по позиции
 		virtual ILayerItem* getLayerItemByPoint(int _left, int _top) const;
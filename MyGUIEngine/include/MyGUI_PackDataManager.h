@@ -0,0 +1,74 @@
+/*
+ * This source file is part of MyGUI. For the latest info, see http://mygui.info/
+ * Distributed under the MIT License
+ * (See accompanying file COPYING.MIT or copy at http://opensource.org/licenses/MIT)
+ */
+
+#ifndef MYGUI_PACK_DATA_MANAGER_H_
+#define MYGUI_PACK_DATA_MANAGER_H_
+
+#include "MyGUI_Prerequest.h"
+#include "MyGUI_DataManager.h"
+
+namespace MyGUI
+{
+
+	class DataPack;
+
+	/** Data manager that serves data from pack files made with DataPack::create,
+		it is created instead of platform data manager, render manager of platform is used as usual.
+		Textures of Dummy, OpenGL, OpenGL3, OpenGLES, DirectX and DirectX11 platforms are read with getData.
+		Ogre platform loads textures from it's own resource group and needs OgreDataManager.
+	*/
+	class MYGUI_EXPORT PackDataManager :
+		public DataManager
+	{
+	public:
+		PackDataManager();
+		virtual ~PackDataManager();
+
+		void initialise();
+		void shutdown();
+
+		static PackDataManager& getInstance()
+		{
+			return *getInstancePtr();
+		}
+		static PackDataManager* getInstancePtr()
+		{
+			return static_cast<PackDataManager*>(DataManager::getInstancePtr());
+		}
+
+		/** @see DataManager::getData(const std::string& _name) */
+		virtual IDataStream* getData(const std::string& _name);
+
+		/** @see DataManager::freeData */
+		virtual void freeData(IDataStream* _data);
+
+		/** @see DataManager::isDataExist(const std::string& _name) */
+		virtual bool isDataExist(const std::string& _name);
+
+		/** @see DataManager::getDataListNames(const std::string& _pattern) */
+		virtual const VectorString& getDataListNames(const std::string& _pattern);
+
+		/** Get path of data inside pack, in form "pack/name". Data in pack can't be opened as file by this path,
+			code that opens files by data path (like Win32 cursors of Common) doesn't work with packs.
+			@see DataManager::getDataPath(const std::string& _name)
+		*/
+		virtual const std::string& getDataPath(const std::string& _name);
+
+		/** Add pack file, when names repeat data of earlier added pack is used.
+			@param _file Pack file name in utf8.
+		*/
+		bool addPack(const std::string& _file);
+
+	private:
+		typedef std::vector<DataPack*> VectorDataPack;
+		VectorDataPack mPacks;
+
+		bool mIsInitialise;
+	};
+
+} // namespace MyGUI
+
+#endif // MYGUI_PACK_DATA_MANAGER_H_
@@ -0,0 +1,102 @@
+/*
+ * This source file is part of MyGUI. For the latest info, see http://mygui.info/
+ * Distributed under the MIT License
+ * (See accompanying file COPYING.MIT or copy at http://opensource.org/licenses/MIT)
+ */
+
+#ifndef MYGUI_PROFILER_H_
+#define MYGUI_PROFILER_H_
+
+#include "MyGUI_Prerequest.h"
+#include "MyGUI_Singleton.h"
+#include <ostream>
+#include <vector>
+
+namespace MyGUI
+{
+
+#define MYGUI_PROFILE_CONCAT_IMPL(a, b) a##b
+#define MYGUI_PROFILE_CONCAT(a, b) MYGUI_PROFILE_CONCAT_IMPL(a, b)
+
+// zones are compiled only when engine is built with MYGUI_ENABLE_PROFILING
+#ifdef MYGUI_ENABLE_PROFILING
+#	define MYGUI_PROFILE_ZONE(name) MyGUI::ProfileZone MYGUI_PROFILE_CONCAT(profileZone, __LINE__)(name)
+#else
+#	define MYGUI_PROFILE_ZONE(name)
+#endif
+
+	/** Recorder of profile zones.
+		Keeps last zones in ring buffer and writes them in Chrome trace format
+		(chrome://tracing, Perfetto). Create instance to start recording, zones
+		are ignored while there is no instance.
+	*/
+	class MYGUI_EXPORT Profiler :
+		public Singleton<Profiler>
+	{
+	public:
+		/** Function that returns current time in microseconds */
+		typedef unsigned long (*ClockFunction)();
+
+		/** @param _capacity Number of last zones kept */
+		explicit Profiler(size_t _capacity = 65536);
+
+		/** Enable or disable recording, enabled by default */
+		void setEnabled(bool _value);
+		bool getEnabled() const;
+
+		/** Set time source, so zones can be merged with application trace.
+			Timer::getCurrentMicroseconds by default.
+		*/
+		void setClock(ClockFunction _value);
+		ClockFunction getClock() const;
+
+		/** Set process and thread id written in trace, to show zones on application thread */
+		void setTraceIds(size_t _processId, size_t _threadId);
+
+		/** Remove all recorded zones */
+		void clear();
+		/** Get number of recorded zones */
+		size_t getZoneCount() const;
+
+		/** Write recorded zones as Chrome trace JSON */
+		void writeChromeTrace(std::ostream& _stream) const;
+		/** Save recorded zones as Chrome trace JSON file */
+		bool saveChromeTrace(const std::string& _fileName) const;
+
+	/*internal:*/
+		void _addZone(const char* _name, unsigned long _start, unsigned long _duration);
+
+	private:
+		struct Zone
+		{
+			const char* name;
+			unsigned long start;
+			unsigned long duration;
+		};
+
+		std::vector<Zone> mZones;
+		size_t mNext;
+		size_t mCount;
+		bool mEnabled;
+		ClockFunction mClock;
+		size_t mProcessId;
+		size_t mThreadId;
+	};
+
+	/** Records time between construction and destruction as zone, use MYGUI_PROFILE_ZONE macro */
+	class MYGUI_EXPORT ProfileZone
+	{
+	public:
+		/** @param _name Zone name, must be string literal or otherwise outlive profiler */
+		explicit ProfileZone(const char* _name);
+		~ProfileZone();
+
+	private:
+		Profiler* mProfiler;
+		const char* mName;
+		unsigned long mStart;
+	};
+
+} // namespace MyGUI
+
+#endif // MYGUI_PROFILER_H_
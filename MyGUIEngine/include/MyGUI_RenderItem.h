@@ -16,7 +16,25 @@
 namespace MyGUI
 {
 
-	typedef std::pair<ISubWidget*, size_t> DrawItemInfo;
+	struct DrawItemInfo
+	{
+		DrawItemInfo(ISubWidget* _item, size_t _count) :
+			item(_item),
+			count(_count),
+			offset(0),
+			vertexCount(0),
+			outOfDate(true)
+		{
+		}
+
+		ISubWidget* item;
+		// reserved vertex count
+		size_t count;
+		// position and vertex count of item in buffer after last render
+		size_t offset;
+		size_t vertexCount;
+		bool outOfDate;
+	};
 	typedef std::vector<DrawItemInfo> VectorDrawItem;
 
 	class MYGUI_EXPORT RenderItem
@@ -38,6 +56,8 @@ namespace MyGUI
 		void reallockDrawItem(ISubWidget* _item, size_t _count);
 
 		void outOfDate();
+		/** Mark only vertices of one draw item as out of date */
+		void outOfDate(ISubWidget* _item);
 		bool isOutOfDate() const;
 
 		size_t getNeedVertexCount() const;
@@ -53,6 +73,11 @@ namespace MyGUI
 		void setNeedCompression(bool _compression);
 		bool getNeedCompression() const;
 
+	private:
+		void updateAllDrawItems();
+		bool updateOutOfDateDrawItems();
+		size_t renderDrawItem(DrawItemInfo& _info, Vertex* _buffer, size_t _offset);
+
 	private:
 #if MYGUI_DEBUG_MODE == 1
 		std::string mTextureName;
@@ -63,6 +88,8 @@ namespace MyGUI
 		size_t mNeedVertexCount;
 
 		bool mOutOfDate;
+		// number of draw items that need to update only their own vertices
+		size_t mOutOfDateDrawItems;
 		VectorDrawItem mDrawItems;
 
 		// колличество отрендренных реально вершин
@@ -13,6 +13,8 @@
 #include "MyGUI_ITexture.h"
 #include "MyGUI_IVertexBuffer.h"
 #include "MyGUI_IRenderTarget.h"
+#include "MyGUI_TextureAtlas.h"
+#include "MyGUI_FrameStatistics.h"
 
 namespace MyGUI
 {
@@ -21,6 +23,7 @@ namespace MyGUI
 		public Singleton<RenderManager>
 	{
 	public:
+		RenderManager();
 
 		/** Create vertex buffer.
 			This method should create vertex buffer with triangles list type,
@@ -46,15 +49,69 @@ namespace MyGUI
 		/** Check if texture format supported by hardware */
 		virtual bool isFormatSupported(PixelFormat _format, TextureUsage _usage);
 
+		/** Check if render system has built-in shader that can be set with ITexture::setShader.
+			"DistanceField" shader renders glyphs stored as signed distance field.
+		*/
+		virtual bool isShaderSupported(const std::string& _shaderName);
+
 #if MYGUI_DEBUG_MODE == 1
 		/** Check if texture is valid */
 		virtual bool checkTexture(ITexture* _texture);
 #endif
 
+		/** Get number of vertex buffer allocations and reallocations during last frame */
+		size_t getVertexBufferReallocations() const;
+
+		/** Get counters of last complete frame */
+		const FrameStatistics& getFrameStatistics() const;
+
+		/** Enable measuring time of frame phases (frame event, controllers, input picking,
+			vertex generation, submission). Disabled by default, because it adds timer calls
+			for every rendered batch.
+		*/
+		void setFrameTiming(bool _value);
+		/** Is measuring time of frame phases enabled */
+		bool getFrameTiming() const;
+
+		/** Enable runtime texture atlas.
+			When enabled, small textures of skins and image sets loaded after this call
+			are packed into shared atlas pages, so they can be rendered in one batch.
+		*/
+		void setTextureAtlasing(bool _value);
+		/** Is runtime texture atlas enabled */
+		bool getTextureAtlasing() const;
+
+	/*internal:*/
+		void _notifyVertexBufferReallocated();
+		size_t _getFrameNumber() const;
+
+		/** Get counters of current frame, that is still collected */
+		FrameStatistics& _getFrameStatistics();
+		void _notifyBatchRendered(ITexture* _texture);
+
+		/** Get atlas page and offset for texture, returns false if texture is not atlased */
+		bool _getTextureAtlasPlacement(const std::string& _texture, std::string& _page, IntPoint& _offset);
+		void _clearTextureAtlas();
+
+		/** Regenerate vertices of all render items on next rendering,
+			used when content of shared texture moved (e.g. glyphs evicted from font cache).
+		*/
+		void _requestFullUpdate();
+
 	protected:
 		virtual void onResizeView(const IntSize& _viewSize);
 		virtual void onRenderToTarget(IRenderTarget* _target, bool _update);
 		virtual void onFrameEvent(float _time);
+
+	private:
+		size_t mFrameNumber;
+		FrameStatistics mStatistics;
+		FrameStatistics mLastStatistics;
+		ITexture* mLastBatchTexture;
+		bool mFrameTiming;
+		bool mTextureAtlasing;
+		bool mFullUpdate;
+		TextureAtlas mTextureAtlas;
 	};
 
 } // namespace MyGUI
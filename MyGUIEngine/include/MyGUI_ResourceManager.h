@@ -34,6 +34,13 @@ namespace MyGUI
 
 		void loadFromXmlNode(xml::ElementPtr _node, const std::string& _file, Version _version);
 
+		/** Compile MyGUI *_resource.xml file to binary form, that is loaded without parsing text.
+			@param _file Name of source file, found with DataManager.
+			@param _destination Path of compiled file. Compiled file replaces source one with same name in resource location,
+				files included from it are not compiled.
+		*/
+		bool compile(const std::string& _file, const std::string& _destination);
+
 		/** Add resource item to resources */
 		void addResource(IResourcePtr _item);
 
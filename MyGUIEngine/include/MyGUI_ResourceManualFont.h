@@ -10,6 +10,7 @@
 #include "MyGUI_Prerequest.h"
 #include "MyGUI_ITexture.h"
 #include "MyGUI_IFont.h"
+#include "MyGUI_GlyphTable.h"
 
 #ifndef MYGUI_NO_CXX11
 #	include <unordered_map>
@@ -53,6 +54,10 @@ namespace MyGUI
 		// Loads the texture specified by mSource.
 		void loadTexture();
 
+		// Adds the glyph info for the specified code point to mCharMap and mGlyphTable, unless the code point already has one.
+		// Returns the glyph info of the code point.
+		GlyphInfo& insertGlyphInfo(Char _id, const GlyphInfo& _info);
+
 		// A map of code points to glyph info objects.
 #ifdef MYGUI_NO_CXX11
 		typedef std::map<Char, GlyphInfo> CharMap;
@@ -69,6 +74,7 @@ namespace MyGUI
 		MyGUI::ITexture* mTexture; // The texture that contains all of the rendered glyphs in the font.
 
 		CharMap mCharMap; // A map of code points to glyph info objects.
+		GlyphTable mGlyphTable; // An index of mCharMap for fast lookup by code point.
 	};
 
 } // namespace MyGUI
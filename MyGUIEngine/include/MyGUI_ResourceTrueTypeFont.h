@@ -10,6 +10,7 @@
 #include "MyGUI_Prerequest.h"
 #include "MyGUI_ITexture.h"
 #include "MyGUI_IFont.h"
+#include "MyGUI_GlyphTable.h"
 
 #ifdef MYGUI_USE_FREETYPE
 #	include <ft2build.h>
@@ -18,6 +19,7 @@
 
 #ifndef MYGUI_NO_CXX11
 #	include <unordered_map>
+#	include <exception>
 #endif
 
 namespace MyGUI
@@ -47,6 +49,13 @@ namespace MyGUI
 		// update texture after render device lost event
 		virtual void textureInvalidate(ITexture* _texture);
 
+		// Returns whether kerning is enabled and the font face has kerning information.
+		virtual bool hasKerning();
+
+		// Returns the kerning of the specified pair of code points from the font face. Values are cached, so every pair is looked
+		// up in the font face only once.
+		virtual float getKerning(Char _left, Char _right);
+
 		// Returns a collection of code-point ranges that are supported by this font. Each range is specified as [first, second];
 		// for example, a range containing a single code point will have the same value for both first and second.
 		std::vector<std::pair<Char, Char> > getCodePointRanges() const;
@@ -68,9 +77,43 @@ namespace MyGUI
 		void setSubstituteCode(int _value);
 		void setDistance(int _value);
 
+		// Enables lazy mode, in which glyphs are rendered on first request instead of during initialisation. The font face stays
+		// loaded, and glyphs are cached in a texture of fixed size divided into pages; when the texture is full, the least
+		// recently used page is evicted. The first page holds the special and substitute glyphs and is never evicted.
+		void setLazy(bool _value);
+		// Width and height of the glyph cache texture in lazy mode, in pixels (rounded up to a power of two).
+		void setLazyTextureSize(int _value);
+		// Number of pages the glyph cache texture is divided into in lazy mode (at least two).
+		void setLazyPageCount(int _value);
+
+		// Enables distance field mode, in which glyphs are stored as a signed distance field and rendered with the "DistanceField"
+		// shader, so that one texture renders the font crisply at any height. Requires a render system that supports this shader;
+		// otherwise, the font is rendered as usual.
+		void setDistanceField(bool _value);
+		// How far the distance field extends outside and inside of the glyph outlines, in pixels.
+		void setDistanceFieldSpread(int _value);
+
+		// Enables kerning, in which the distance between pairs of glyphs is adjusted as specified by the font face. The font face
+		// stays loaded while kerning is enabled and the face has kerning information.
+		void setKerning(bool _value);
+
+		// Sets the name of a font cache file created by saveCache(). If the file exists and was saved for the same font source,
+		// properties, and texture format, the font is loaded from it instead of being rendered; otherwise, it is rendered as usual.
+		// Lazy fonts don't use the cache.
+		void setCache(const std::string& _value);
+
+		// Saves the texture and glyphs of the font into the specified font cache file, which can be shipped along with the font
+		// source and loaded with setCache(). Returns false if the font is lazy or could not be saved.
+		bool saveCache(const std::string& _fileName);
+
 		void addCodePointRange(Char _first, Char _second);
 		void removeCodePointRange(Char _first, Char _second);
 
+		// Sets how many threads, including the calling one, render the glyphs of fonts that are not lazy. Each thread loads its own
+		// font face and renders into its own texture regions, so the texture is the same for any number of threads. Zero (the
+		// default) uses one thread per hardware thread; one renders all glyphs on the calling thread.
+		static void setRenderThreadCount(size_t _value);
+
 #ifdef MYGUI_USE_FREETYPE
 	private:
 		enum Hinting
@@ -97,11 +140,61 @@ namespace MyGUI
 		float mTabWidth; // The width of the "Tab" special character, in pixels.
 		int mOffsetHeight; // How far up to nudge text rendered in this font, in pixels. May be negative to nudge text down.
 		Char mSubstituteCodePoint; // The code point to use as a substitute for code points that don't exist in the font.
+		bool mLazy; // Whether glyphs are rendered on first request instead of during initialisation.
+		int mLazyTextureSize; // Width and height of the glyph cache texture in lazy mode, in pixels.
+		int mLazyPageCount; // Number of pages of the glyph cache texture in lazy mode.
+		bool mDistanceField; // Whether glyphs are stored as a signed distance field.
+		int mDistanceFieldSpread; // How far the distance field extends from the glyph outlines, in pixels.
+		std::string mCache; // Name of the font cache file to load the font from.
+		bool mKerning; // Whether the distance between pairs of glyphs is adjusted by the kerning of the font face.
 
 		// The following variables are calculated automatically.
 		int mDefaultHeight; // The nominal height of the font in pixels.
 		GlyphInfo* mSubstituteGlyphInfo; // The glyph info to use as a substitute for code points that don't exist in the font.
 		MyGUI::ITexture* mTexture; // The texture that contains all of the rendered glyphs in the font.
+		bool mUseDistanceField; // Whether distance field mode is enabled and supported by the render system.
+		std::string mCacheKey; // The font properties and texture format that a font cache file must match, except for the source.
+		bool mCacheLoaded; // Whether the font was loaded from the font cache file.
+
+		// A map of code point pairs to kerning values.
+#ifdef MYGUI_NO_CXX11
+		typedef std::map<std::pair<Char, Char>, float> KerningMap;
+#else
+		struct KerningPairHash
+		{
+			size_t operator()(const std::pair<Char, Char>& _pair) const
+			{
+				return _pair.first * 0x9E3779B1U ^ _pair.second;
+			}
+		};
+
+		typedef std::unordered_map<std::pair<Char, Char>, float, KerningPairHash> KerningMap;
+#endif
+
+		KerningMap mKerningCache; // Kerning values looked up in mFtFace so far.
+
+		// The following variables are used only in lazy mode, and mFtLibrary, mFtFace and mFontBuffer also for kerning.
+		struct GlyphPage
+		{
+			int top; // First texture row of the page.
+			int bottom; // Texture row just past the page.
+			int shelfLeft; // Texture column just past the last glyph on the current shelf.
+			int shelfTop; // First texture row of the current shelf.
+			int shelfHeight; // Height of the current shelf, including glyph spacing.
+			size_t lastUsed; // Frame number when a glyph on this page was last requested.
+			bool cleared; // Whether the page pixels have been cleared; pages are cleared on first use.
+		};
+
+		FT_Library mFtLibrary; // The FreeType library, kept alive to render glyphs on request or look up kerning.
+		FT_Face mFtFace; // The font face, kept loaded to render glyphs on request or look up kerning.
+		uint8* mFontBuffer; // The font file loaded in memory, used by mFtFace.
+		FT_Int32 mFtLoadFlags; // The glyph load flags based on the type of hinting.
+		int mFontAscent; // The ascent of the font face, in pixels.
+		bool mLAMode; // Whether the texture uses the L8A8 format.
+		bool mLazyCacheFull; // Whether the glyph cache overflow has already been reported.
+		int mPageHeight; // Height of one page, in pixels.
+		std::vector<GlyphPage> mPages; // Pages of the glyph cache texture.
+		std::vector<uint8> mTextureData; // Copy of the texture pixels, used for partial texture updates.
 
 		// The following constants used to be mutable, but they no longer need to be. Do not modify their values!
 		static const int mDefaultGlyphSpacing; // How far apart the glyphs are placed from each other in the font texture, in pixels.
@@ -126,6 +219,15 @@ namespace MyGUI
 		template<bool LAMode, bool Antialias>
 		void initialiseFreeType();
 
+		// Returns the properties that affect the rendered font, in the form stored in font cache files.
+		std::string getCacheKey(bool _laMode) const;
+
+		// Appends the size and hash of the font source to _key. Returns false if the source could not be read.
+		bool addSourceToCacheKey(std::string& _key) const;
+
+		// Loads the texture and glyphs from the font cache file if it matches mCacheKey and the font source.
+		bool loadCache();
+
 		// Loads the font face as specified by mSource, mSize, and mResolution. Automatically adjusts code-point ranges according
 		// to the capabilities of the font face.
 		// Returns a handle to the FreeType face object for the face, or nullptr if the face could not be loaded.
@@ -140,6 +242,10 @@ namespace MyGUI
 		// Creates a GlyphInfo object using the specified information.
 		GlyphInfo createFaceGlyphInfo(Char _codePoint, int _fontAscent, FT_GlyphSlot _glyph);
 
+		// Adds the glyph info for the specified code point to mGlyphMap and mGlyphTable, unless the code point already has one.
+		// Returns the glyph info of the code point.
+		GlyphInfo& insertGlyphInfo(Char _codePoint, const GlyphInfo& _info);
+
 		// Creates a glyph with the specified glyph index and assigns it to the specified code point.
 		// Automatically updates _glyphHeightMap, mCharMap, and mGlyphMap with data from the new glyph..
 		int createGlyph(FT_UInt _glyphIndex, const GlyphInfo& _glyphInfo, GlyphHeightMap& _glyphHeightMap);
@@ -148,18 +254,99 @@ namespace MyGUI
 		// Automatically updates _glyphHeightMap with data from the newly created glyph.
 		int createFaceGlyph(FT_UInt _glyphIndex, Char _codePoint, int _fontAscent, const FT_Face& _ftFace, FT_Int32 _ftLoadFlags, GlyphHeightMap& _glyphHeightMap);
 
+		// A glyph from the font face waiting to be rendered at the specified texture position.
+		struct GlyphRenderJob
+		{
+			FT_UInt glyphIndex;
+			GlyphInfo* info;
+			int texX;
+			int texY;
+			int lineHeight;
+			bool done; // Whether a thread has taken the job.
+			bool failed; // Whether FreeType could not render the glyph.
+		};
+
+		typedef std::vector<GlyphRenderJob> VectorGlyphRenderJob;
+
 		// Renders all of the glyphs in _glyphHeightMap into the specified texture buffer using data from the specified font face.
+		// The special glyphs are rendered right away; the glyphs from the font face are laid out first and then rendered by
+		// renderGlyphJobs(), on several threads if possible.
 		template<bool LAMode, bool Antialias>
 		void renderGlyphs(const GlyphHeightMap& _glyphHeightMap, const FT_Library& _ftLibrary, const FT_Face& _ftFace, FT_Int32 _ftLoadFlags, uint8* _texBuffer, int _texWidth, int _texHeight);
 
+		// Renders every _step-th job starting from _first using the specified font face.
+		template<bool LAMode, bool Antialias>
+		void renderGlyphJobs(VectorGlyphRenderJob& _jobs, size_t _first, size_t _step, const FT_Library& _ftLibrary, const FT_Face& _ftFace, FT_Int32 _ftLoadFlags, uint8* _texBuffer, int _texWidth, int _texHeight);
+
+#ifndef MYGUI_NO_CXX11
+		// Does the same as renderGlyphJobs() with a copy of the specified font face, so that it can run on a worker thread. Jobs are
+		// left undone if the copy can't be loaded. An exception is stored in _error, to be rethrown on the calling thread.
+		template<bool LAMode, bool Antialias>
+		void renderGlyphJobsWorker(VectorGlyphRenderJob* _jobs, size_t _first, size_t _step, FT_Face _ftFace, FT_Int32 _ftLoadFlags, uint8* _texBuffer, int _texWidth, int _texHeight, std::exception_ptr* _error);
+#endif
+
 		// Renders the glyph described by the specified glyph info according to the specified parameters.
 		// Supports two types of rendering, depending on the value of UseBuffer: Texture block transfer and rectangular color fill.
 		// The _luminance0 value is used for even-numbered columns (from zero), while _luminance1 is used for odd-numbered ones.
 		template<bool LAMode, bool UseBuffer, bool Antialias>
 		void renderGlyph(GlyphInfo& _info, uint8 _luminance0, uint8 _luminance1, uint8 _alpha, int _lineHeight, uint8* _texBuffer, int _texWidth, int _texHeight, int& _texX, int& _texY, uint8* _glyphBuffer = nullptr);
 
+		// Renders the glyph bitmap of the specified size as a signed distance field with the glyph size described by the specified
+		// glyph info, which includes the spread on every side. Distance field pixels are stored with a green tint, so that the
+		// shader can tell them from the pixels of the special glyphs.
+		void renderDistanceFieldGlyph(GlyphInfo& _info, int _lineHeight, uint8* _texBuffer, int _texWidth, int _texHeight, int& _texX, int& _texY, const uint8* _glyphBuffer, int _glyphWidth, int _glyphHeight);
+
+		// Keeps the font face loaded and creates the glyph cache texture with the special and substitute glyphs on its first page.
+		template<bool LAMode, bool Antialias>
+		void initialiseLazy(const FT_Library& _ftLibrary, const FT_Face& _ftFace, uint8* _fontBuffer, int _fontAscent, FT_Int32 _ftLoadFlags);
+
+		// Keeps the specified font face loaded for getKerning() if kerning is enabled and the face has kerning information;
+		// otherwise, releases the face, the library, and the font buffer.
+		void keepFaceForKerning(const FT_Library& _ftLibrary, const FT_Face& _ftFace, uint8* _fontBuffer);
+
+		// Releases the font face kept by lazy mode or for kerning.
+		void shutdownLazy();
+
+		// Renders the glyph for the specified code point into the glyph cache texture, evicting a page if needed.
+		// Returns nullptr if the code point doesn't exist in the font or the glyph doesn't fit in the cache.
+		GlyphInfo* createLazyGlyph(Char _codePoint);
+
+		template<bool LAMode, bool Antialias>
+		GlyphInfo* createLazyGlyph(Char _codePoint, FT_UInt _glyphIndex);
+
+		// Renders a special glyph filled with the specified alpha into the glyph cache texture.
+		template<bool LAMode>
+		GlyphInfo* createLazySpecialGlyph(FT_UInt _glyphIndex, const GlyphInfo& _glyphInfo, uint8 _alpha);
+
+		// Finds space for a glyph of the specified size in the glyph cache texture, evicting the least recently used page if
+		// there is no space left. Returns false if there is no space and every page was used in the current frame.
+		template<bool LAMode>
+		bool allocateLazyGlyph(int _width, int _height, int& _texX, int& _texY);
+
+		// Finds space for a glyph of the specified size on the current shelf of the specified page, or on a new shelf below it.
+		bool allocateLazyGlyphOnPage(GlyphPage& _page, int _width, int _height, int& _texX, int& _texY);
+
+		// Removes all glyphs of the specified page and clears its pixels.
+		template<bool LAMode>
+		void evictLazyPage(size_t _index);
+
+		// Makes the pixels of the specified page transparent white and resets its shelves.
+		template<bool LAMode>
+		void clearLazyPage(size_t _index);
+
+		// Returns the index of the page that contains the specified glyph.
+		size_t getLazyPage(const GlyphInfo& _info) const;
+
+		// Uploads the specified rectangle of mTextureData to the texture.
+		void updateLazyTexture(const IntCoord& _coord);
+
+		// Returns an 8-bit bitmap of the glyph loaded in the glyph slot of _ftFace, converting monochrome bitmaps into _ftBitmap.
+		// Returns nullptr if the glyph has no bitmap.
+		uint8* getGlyphBitmap(const FT_Library& _ftLibrary, const FT_Face& _ftFace, FT_Bitmap& _ftBitmap);
+
 		CharMap mCharMap; // A map of code points to glyph indices.
 		GlyphMap mGlyphMap; // A map of code points to glyph info objects.
+		GlyphTable mGlyphTable; // An index of mGlyphMap for fast lookup by code point.
 
 #endif // MYGUI_USE_FREETYPE
 
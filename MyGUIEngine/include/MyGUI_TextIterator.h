@@ -25,6 +25,13 @@ namespace MyGUI
 
 		bool moveNext();
 
+		/** Move forward to position _position, same as calling moveNext until getPosition is _position,
+			but much faster for long text. If _colour is not nullptr it gets last colour tag that
+			getTagColour finds at positions before _position.
+			@return false if end of text reached before _position.
+		*/
+		bool moveToPosition(size_t _position, UString* _colour = nullptr);
+
 		// возвращает цвет
 		bool getTagColour(UString& _colour) const;
 
@@ -87,6 +94,10 @@ namespace MyGUI
 
 		void clear();
 
+		// пропускает символы начиная с _index, увеличивая _count, пока он не равен _max
+		// возвращает индекс символа на котором остановились или размер текста
+		size_t skipChars(size_t _index, size_t& _count, size_t _max) const;
+
 		void normaliseNewLine(UString& _colour);
 
 	private:
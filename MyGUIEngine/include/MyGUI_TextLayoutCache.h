@@ -0,0 +1,107 @@
+/*
+ * This source file is part of MyGUI. For the latest info, see http://mygui.info/
+ * Distributed under the MIT License
+ * (See accompanying file COPYING.MIT or copy at http://opensource.org/licenses/MIT)
+ */
+
+#ifndef MYGUI_TEXT_LAYOUT_CACHE_H_
+#define MYGUI_TEXT_LAYOUT_CACHE_H_
+
+#include "MyGUI_Prerequest.h"
+#include "MyGUI_TextView.h"
+#include <map>
+#include <list>
+
+namespace MyGUI
+{
+
+	/** Cache of text layouts shared by text subwidgets.
+		Widgets with the same caption, font, height, align, colour format and wrap width
+		use one layout, that is made once and never changed. Layouts are reference counted,
+		layouts that are not used by any widget are kept until capacity is reached,
+		least recently released are destroyed first.
+	*/
+	class MYGUI_EXPORT TextLayoutCache
+	{
+	public:
+		TextLayoutCache();
+		~TextLayoutCache();
+
+		/** Get layout of text, text is laid out if there is no such layout in cache.
+			Every acquired layout must be returned with release.
+		*/
+		const TextView* acquire(const UString& _text, IFont* _font, int _height, Align _align, VertexColourType _format, int _maxWidth);
+		/** Return layout acquired from cache */
+		void release(const TextView* _view);
+
+		/** Forget layouts of font, used when font is destroyed or its glyphs changed.
+			Layouts still in use are destroyed on release.
+		*/
+		void removeFont(IFont* _font);
+		/** Forget all layouts */
+		void clear();
+
+		/** Set number of unused layouts kept in cache */
+		void setCapacity(size_t _value);
+		/** Get number of unused layouts kept in cache */
+		size_t getCapacity() const;
+
+		/** Set maximum length of cached text. Longer texts are usually edited, so they are laid out
+			by their widgets incrementally. 0 disables cache.
+		*/
+		void setMaxTextLength(size_t _value);
+		/** Get maximum length of cached text */
+		size_t getMaxTextLength() const;
+
+		/** Get number of layouts in cache, used and unused */
+		size_t getSize() const;
+		/** Get number of acquire calls that found layout in cache */
+		size_t getHits() const;
+		/** Get number of acquire calls that laid out text */
+		size_t getMisses() const;
+		/** Get part of acquire calls that found layout in cache, from 0 to 1 */
+		float getHitRate() const;
+		/** Reset hits and misses */
+		void resetStatistics();
+
+	private:
+		struct Entry;
+		typedef std::list<Entry*> ListEntry;
+
+		struct Entry :
+			public TextView
+		{
+			size_t hash;
+			UString text;
+			IFont* font;
+			int height;
+			Align align;
+			VertexColourType format;
+			int maxWidth;
+			size_t references;
+			// entry is in map and can be found by acquire
+			bool cached;
+			// position in mUnused when there are no references
+			ListEntry::iterator unused;
+		};
+
+		void removeEntry(Entry* _entry);
+		void removeUnused(size_t _count);
+
+	private:
+		typedef std::multimap<size_t, Entry*> MapEntry;
+		MapEntry mEntries;
+		// entries without references, most recently released first
+		ListEntry mUnused;
+
+		size_t mCapacity;
+		size_t mMaxTextLength;
+		size_t mHits;
+		size_t mMisses;
+		// changed when layouts are removed
+		size_t mGeneration;
+	};
+
+} // namespace MyGUI
+
+#endif // MYGUI_TEXT_LAYOUT_CACHE_H_
@@ -15,16 +15,22 @@
 namespace MyGUI
 {
 
-	class TextView
+	class MYGUI_EXPORT TextView
 	{
 	public:
 		TextView();
 
+		/** Layout text. If only text changed since previous update, lines before the first changed one are kept,
+			and so are lines after the change that start after line break, so editing long text lays out only changed lines.
+		*/
 		void update(const UString& _text, IFont* _font, int _height, Align _align, VertexColourType _format, int _maxWidth = -1);
 
-		size_t getCursorPosition(const IntPoint& _value);
+		/** Layout all text on next update, used when glyphs of font changed (e.g. after texture was recreated) */
+		void invalidate();
 
-		IntPoint getCursorPoint(size_t _position);
+		size_t getCursorPosition(const IntPoint& _value) const;
+
+		IntPoint getCursorPoint(size_t _position) const;
 
 		const IntSize& getViewSize() const;
 
@@ -32,11 +38,36 @@ namespace MyGUI
 
 		const VectorLineInfo& getData() const;
 
+		/** Get cursor position of first character of line */
+		size_t getLinePosition(size_t _line) const;
+
+		/** Get last colour tag in lines before _line, or nullptr if there is no such tag */
+		const CharInfo* getLineColour(size_t _line) const;
+
+	private:
+		// first line that must be layout again for new text, previous lines are the same,
+		// and length of same end of old and new text, zero if layout parameters changed
+		void getChange(const UString& _text, IFont* _font, int _height, VertexColourType _format, int _maxWidth, size_t& _firstLine, size_t& _sameEnd) const;
+		// line that starts at _start in mText, searched from _firstLine, or ITEM_NONE
+		size_t findLine(size_t _start, size_t _firstLine) const;
+
 	private:
 		IntSize mViewSize;
 		size_t mLength;
 		VectorLineInfo mLineInfo;
 		int mFontHeight;
+
+		// text and parameters of previous update
+		UString mText;
+		IFont* mFont;
+		VertexColourType mFormat;
+		int mMaxWidth;
+		// position of first character of every line in mText
+		std::vector<size_t> mLineStart;
+		// cursor position of first character of every line
+		std::vector<size_t> mLinePosition;
+		// last line with colour tag before every line, or ITEM_NONE
+		std::vector<size_t> mColourLine;
 	};
 
 } // namespace MyGUI
@@ -0,0 +1,81 @@
+/*
+ * This source file is part of MyGUI. For the latest info, see http://mygui.info/
+ * Distributed under the MIT License
+ * (See accompanying file COPYING.MIT or copy at http://opensource.org/licenses/MIT)
+ */
+
+#ifndef MYGUI_TEXTURE_ATLAS_H_
+#define MYGUI_TEXTURE_ATLAS_H_
+
+#include "MyGUI_Prerequest.h"
+#include "MyGUI_Types.h"
+#include "MyGUI_ITexture.h"
+#include <map>
+#include <set>
+
+namespace MyGUI
+{
+
+	/** Runtime texture atlas.
+		Small textures are copied into shared page textures at load time,
+		so widgets with skins from different files can be rendered in one batch.
+		Source texture loaded for packing is destroyed once its pixels are copied,
+		textures that existed before packing are left to their owners.
+	*/
+	class MYGUI_EXPORT TextureAtlas
+	{
+	public:
+		TextureAtlas();
+		~TextureAtlas();
+
+		/** Get place of texture in atlas, texture is packed on first request.
+			@param _texture Name of source texture.
+			@param _page Name of page texture that contains source texture.
+			@param _offset Position of source texture on page in pixels.
+			@return false if texture can't be packed (too big, unknown format or not found).
+		*/
+		bool getPlacement(const std::string& _texture, std::string& _page, IntPoint& _offset);
+
+		/** Upload pages changed since previous commit, have to be called before rendering with placements.
+			Packed textures are uploaded right away when render system supports partial texture updates.
+		*/
+		void commit();
+
+		/** Destroy all pages and forget placements */
+		void clear();
+
+	private:
+		struct Page
+		{
+			ITexture* texture;
+			std::vector<uint8> data;
+			int shelfLeft;
+			int shelfTop;
+			int shelfHeight;
+			bool dirty;
+		};
+
+		struct Placement
+		{
+			size_t page;
+			IntPoint offset;
+		};
+
+		bool addTexture(const std::string& _texture, Placement& _result);
+		bool allocate(Page& _page, int _width, int _height, IntPoint& _point);
+		void createPage();
+		void copyPixels(Page& _page, const uint8* _source, int _width, int _height, const IntPoint& _point);
+
+	private:
+		typedef std::vector<Page> VectorPage;
+		VectorPage mPages;
+
+		typedef std::map<std::string, Placement> MapPlacement;
+		MapPlacement mPlacements;
+
+		std::set<std::string> mRejected;
+	};
+
+} // namespace MyGUI
+
+#endif // MYGUI_TEXTURE_ATLAS_H_
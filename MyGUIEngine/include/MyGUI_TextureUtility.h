@@ -19,6 +19,10 @@ namespace MyGUI
 
 		MYGUI_EXPORT const IntSize& getTextureSize(const std::string& _texture, bool _cache = true);
 		MYGUI_EXPORT uint32 toColourARGB(const Colour& _colour);
+		/** Convert pixel coordinates in texture to texture coordinates,
+			taking into account texture atlas if texture is packed into it.
+		*/
+		MYGUI_EXPORT FloatRect getTextureRect(const std::string& _texture, const IntCoord& _coord);
 
 		MYGUI_FORCEINLINE void convertColour(uint32& _colour, VertexColourType _format)
 		{
@@ -20,6 +20,9 @@ namespace MyGUI
 		void reset();
 		unsigned long getMilliseconds();
 
+		/** Get current time in microseconds, value wraps around so use it only for differences */
+		static unsigned long getCurrentMicroseconds();
+
 	private:
 		unsigned long getCurrentMilliseconds();
 
@@ -0,0 +1,48 @@
+/*
+ * This source file is part of MyGUI. For the latest info, see http://mygui.info/
+ * Distributed under the MIT License
+ * (See accompanying file COPYING.MIT or copy at http://opensource.org/licenses/MIT)
+ */
+
+#ifndef MYGUI_VERTEX_BUFFER_CAPACITY_H_
+#define MYGUI_VERTEX_BUFFER_CAPACITY_H_
+
+#include "MyGUI_Prerequest.h"
+
+namespace MyGUI
+{
+
+	/** Capacity policy for growable vertex buffers.
+		Capacity grows geometrically, so changing vertex count rarely needs reallocation,
+		and shrinks only when buffer stayed much bigger than needed for several frames.
+	*/
+	class MYGUI_EXPORT VertexBufferCapacity
+	{
+	public:
+		VertexBufferCapacity();
+
+		/** Check capacity for _count vertices.
+			@return true if buffer have to be recreated with getCapacity() vertices.
+		*/
+		bool update(size_t _count);
+
+		/** Check whether buffer stayed too big for _count vertices long enough and should be shrunk.
+			Have to be called every frame, update() shrinks buffer when this returns true.
+		*/
+		bool checkShrink(size_t _count);
+
+		/** Get number of vertices buffer should be allocated for */
+		size_t getCapacity() const;
+
+		/** Forget current capacity, next update will always request reallocation */
+		void reset();
+
+	private:
+		size_t mCapacity;
+		bool mOversized;
+		size_t mOversizedFrame;
+	};
+
+} // namespace MyGUI
+
+#endif // MYGUI_VERTEX_BUFFER_CAPACITY_H_
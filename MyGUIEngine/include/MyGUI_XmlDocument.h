@@ -102,6 +102,9 @@ namespace MyGUI
 
 		class Element;
 		class Document;
+		class ElementArena;
+		struct ArenaAttribute;
+		class BinaryReader;
 
 		typedef Element* ElementPtr;
 		typedef std::pair<std::string, std::string> PairAttribute;
@@ -158,14 +161,22 @@ namespace MyGUI
 		class MYGUI_EXPORT Element
 		{
 			friend class Document;
+			friend class ElementArena;
 
 		public:
 			~Element();
 
 		private:
 			Element(const std::string& _name, ElementPtr _parent, ElementType _type = ElementType::Normal, const std::string& _content = "");
+			Element(const std::string* _name, ElementPtr _parent, ElementType _type, ElementArena* _arena);
 			void save(std::ostream& _stream, size_t _level);
 
+			// переносит атрибуты из арены в вектор, дальше они меняются как обычно
+			void prepareAttributes() const;
+
+			// удаляет узел, память узла из арены освобождается вместе с ареной
+			static void destroy(ElementPtr _element);
+
 		public:
 			ElementPtr createChild(const std::string& _name, const std::string& _content = "", ElementType _type = ElementType::Normal);
 			void removeChild(ElementPtr _child);
@@ -271,10 +282,18 @@ namespace MyGUI
 		private:
 			std::string mName;
 			std::string mContent;
-			VectorAttributes mAttributes;
+			mutable VectorAttributes mAttributes;
 			VectorElement mChilds;
 			ElementPtr mParent;
 			ElementType mType;
+
+			// арена документа, если узел создан в ней
+			ElementArena* mArena;
+			// имя в арене, вместо mName
+			const std::string* mArenaName;
+			// атрибуты в арене, пока они не перенесены в mAttributes
+			mutable const ArenaAttribute* mArenaAttributes;
+			mutable size_t mArenaAttributesCount;
 		};
 
 		//----------------------------------------------------------------------//
@@ -309,6 +328,13 @@ namespace MyGUI
 
 			bool save(const UString& _filename);
 
+			/** Save document in compact binary form. Binary documents are detected by open
+				and read without parsing text, names and values are stored once in string table.
+			*/
+			bool saveBinary(std::ostream& _stream);
+			/** Save document in compact binary form, file name in utf8 */
+			bool saveBinary(const std::string& _filename);
+
 			void clear();
 
 			std::string getLastError();
@@ -320,6 +346,16 @@ namespace MyGUI
 
 			ElementPtr getRoot() const;
 
+			/** Enable or disable arena allocation of elements read by open.
+				Elements are allocated in large blocks freed all at once with document,
+				names of elements and attributes are stored once per document and attributes are kept
+				in arena until they are changed. Elements work as usual, only ones that are read from
+				arena must not be deleted directly. Disabled by default.
+			*/
+			void setArenaAllocation(bool _value);
+			/** Get arena allocation of elements read by open */
+			bool getArenaAllocation() const;
+
 			/*obsolete:*/
 #ifndef MYGUI_DONT_USE_OBSOLETE
 
@@ -335,14 +371,21 @@ namespace MyGUI
 			void setLastFileError(const std::string& _filename);
 			void setLastFileError(const std::wstring& _filename);
 
-			bool parseTag(ElementPtr& _currentNode, std::string _content);
+			// разбирает весь текст документа за один проход
+			bool parse(const char* _begin, const char* _end);
+
+			// разбирает содержимое тега между угловыми скобками
+			bool parseTag(ElementPtr& _currentNode, const char* _begin, const char* _end);
 
-			bool checkPair(std::string& _key, std::string& _value);
+			// читает документ сохраненный saveBinary
+			bool parseBinary(std::string& _buffer);
+			ElementPtr parseBinaryElement(BinaryReader& _reader, ElementPtr _parent);
 
-			bool parseLine(std::string& _line, ElementPtr& _element);
+			// запоминает строку и колонку позиции ошибки
+			void setLastErrorPosition(const char* _begin, const char* _position);
 
-			// ищет символ без учета ковычек
-			size_t find(const std::string& _text, char _char, size_t _start = 0);
+			// создает узел в арене или в куче и добавляет его к родителю
+			ElementPtr createElement(const char* _begin, const char* _end, ElementPtr _parent, ElementType _type);
 
 			void clearDeclaration();
 			void clearRoot();
@@ -354,6 +397,8 @@ namespace MyGUI
 			std::string mLastErrorFile;
 			size_t mLine;
 			size_t mCol;
+			bool mArenaAllocation;
+			ElementArena* mArena;
 
 		}; // class Document
 
@@ -7,8 +7,10 @@
 #include "MyGUI_Precompiled.h"
 #include "MyGUI_Gui.h"
 #include "MyGUI_ControllerManager.h"
+#include "MyGUI_Profiler.h"
 #include "MyGUI_WidgetManager.h"
 #include "MyGUI_FactoryManager.h"
+#include "MyGUI_RenderManager.h"
 
 #include "MyGUI_ControllerEdgeHide.h"
 #include "MyGUI_ControllerFadeAlpha.h"
@@ -118,6 +120,9 @@ namespace MyGUI
 
 	void ControllerManager::frameEntered(float _time)
 	{
+		MYGUI_PROFILE_ZONE("ControllerManager::frameEntered");
+		FrameTimingScope timing(&FrameStatistics::controllersTime);
+
 		for (ListControllerItem::iterator iter = mListItem.begin(); iter != mListItem.end(); /*added in body*/)
 		{
 			if (nullptr == (*iter).first)
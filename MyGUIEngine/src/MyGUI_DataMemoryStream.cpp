@@ -13,20 +13,19 @@ namespace MyGUI
 	DataMemoryStream::DataMemoryStream() :
 		mData(nullptr),
 		mSize(0),
-		mStream(0)
+		mPosition(0)
 	{
 	}
 
 	DataMemoryStream::DataMemoryStream(unsigned char* _data, size_t _size) :
 		mData(_data),
 		mSize(_size),
-		mStream(nullptr)
+		mPosition(0)
 	{
 	}
 
 	DataMemoryStream::~DataMemoryStream()
 	{
-		delete mStream;
 	}
 
 	size_t DataMemoryStream::size()
@@ -36,36 +35,33 @@ namespace MyGUI
 
 	bool DataMemoryStream::eof()
 	{
-		if (mStream == nullptr)
-			prepareStream();
-
-		return mStream->eof();
+		return mPosition >= mSize;
 	}
 
 	void DataMemoryStream::readline(std::string& _source, Char _delim)
 	{
-		if (mStream == nullptr)
-			prepareStream();
+		_source.clear();
+		if (mData == nullptr || mPosition >= mSize)
+			return;
 
-		std::getline(*mStream, _source, (char)_delim);
+		// как getline, разделитель пропускается и в строку не попадает
+		const unsigned char* begin = mData + mPosition;
+		const unsigned char* end = mData + mSize;
+		const unsigned char* delim = std::find(begin, end, (unsigned char)_delim);
+
+		_source.assign((const char*)begin, delim - begin);
+		mPosition = (delim != end ? delim + 1 : end) - mData;
 	}
 
 	size_t DataMemoryStream::read(void* _buf, size_t _count)
 	{
-		if (mData == nullptr)
+		if (mData == nullptr || mPosition >= mSize)
 			return 0;
 
-		size_t count = (std::min)(size(), _count);
-		::memcpy(_buf, mData, count);
+		size_t count = (std::min)(mSize - mPosition, _count);
+		::memcpy(_buf, mData + mPosition, count);
+		mPosition += count;
 		return count;
 	}
 
-	void DataMemoryStream::prepareStream()
-	{
-		if (mData == nullptr)
-			return;
-
-		mStream = new std::stringstream((const char*)mData);
-	}
-
 } // namespace MyGUI
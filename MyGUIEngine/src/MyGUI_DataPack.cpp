@@ -0,0 +1,595 @@
+/*
+ * This source file is part of MyGUI. For the latest info, see http://mygui.info/
+ * Distributed under the MIT License
+ * (See accompanying file COPYING.MIT or copy at http://opensource.org/licenses/MIT)
+ */
+
+#include "MyGUI_Precompiled.h"
+#include "MyGUI_DataPack.h"
+#include "MyGUI_DataMemoryStream.h"
+#include "MyGUI_UString.h"
+#include <fstream>
+#include <iterator>
+#include <set>
+
+#if MYGUI_PLATFORM == MYGUI_PLATFORM_WIN32
+#	include <windows.h>
+#else
+#	include <sys/mman.h>
+#	include <sys/stat.h>
+#	include <fcntl.h>
+#	include <unistd.h>
+#endif
+
+namespace MyGUI
+{
+
+	namespace
+	{
+
+		const char PackMagic[] = "MYGUIPAK";
+		const size_t PackMagicSize = sizeof(PackMagic) - 1;
+		const uint32 PackVersion = 1;
+		// заголовок: метка, версия, число записей, смещение каталога
+		const size_t PackHeaderSize = PackMagicSize + 4 + 4 + 8;
+		// запись каталога с пустым именем: длина имени, метод, смещение, размеры
+		const size_t PackEntryMinSize = 2 + 1 + 8 + 8 + 8;
+
+		enum PackMethod
+		{
+			PackMethodStored,
+			PackMethodLZ4
+		};
+
+		// поток распакованной записи, владеет своим буфером
+		class DataPackStream :
+			public DataMemoryStream
+		{
+		public:
+			DataPackStream(size_t _size) :
+				mBuffer(_size)
+			{
+				mData = mBuffer.empty() ? nullptr : &mBuffer[0];
+				mSize = _size;
+			}
+
+			uint8* getBuffer()
+			{
+				return mData;
+			}
+
+		private:
+			std::vector<uint8> mBuffer;
+		};
+
+		// числа в пакете в little endian
+		void writeNumber(std::ostream& _stream, size_t _value, size_t _bytes)
+		{
+			for (size_t index = 0; index < _bytes; ++index)
+			{
+				_stream.put((char)(_value & 0xFF));
+				_value = index < sizeof(size_t) - 1 ? _value >> 8 : 0;
+			}
+		}
+
+		bool readNumber(const uint8*& _position, const uint8* _end, size_t _bytes, size_t& _value)
+		{
+			if ((size_t)(_end - _position) < _bytes)
+				return false;
+
+			_value = 0;
+			for (size_t index = 0; index < _bytes; ++index)
+			{
+				size_t value = _position[index];
+				if (index >= sizeof(size_t))
+				{
+					// не помещается в адресное пространство
+					if (value != 0)
+						return false;
+					continue;
+				}
+				_value |= value << (index * 8);
+			}
+
+			_position += _bytes;
+			return true;
+		}
+
+		bool isMatch(const char* _name, const char* _mask)
+		{
+			// позиция последней звездочки, с нее продолжаем при несовпадении
+			const char* star = nullptr;
+			const char* starName = nullptr;
+			while (*_name != 0)
+			{
+				if (*_mask == '*')
+				{
+					star = ++_mask;
+					starName = _name;
+				}
+				else if (*_mask == '?' || *_mask == *_name)
+				{
+					++_mask;
+					++_name;
+				}
+				else if (star != nullptr)
+				{
+					_mask = star;
+					_name = ++starName;
+				}
+				else
+				{
+					return false;
+				}
+			}
+
+			while (*_mask == '*')
+				++_mask;
+			return *_mask == 0;
+		}
+
+		//----------------------------------------------------------------------//
+		// LZ4 block format
+		//----------------------------------------------------------------------//
+		const size_t LZ4MinMatch = 4;
+		// последние байты всегда литералы, совпадение начинается не ближе к концу
+		const size_t LZ4LastLiterals = 5;
+		const size_t LZ4MatchLimit = 12;
+		const size_t LZ4MaxOffset = 65535;
+		const size_t LZ4HashBits = 14;
+		// байт длины дает не больше 255 байт данных
+		const size_t LZ4MaxRatio = 255;
+
+		uint32 readUInt32(const uint8* _data)
+		{
+			uint32 result;
+			::memcpy(&result, _data, sizeof(result));
+			return result;
+		}
+
+		void writeLength(std::vector<uint8>& _result, size_t _length)
+		{
+			while (_length >= 255)
+			{
+				_result.push_back(255);
+				_length -= 255;
+			}
+			_result.push_back((uint8)_length);
+		}
+
+		void writeSequence(std::vector<uint8>& _result, const uint8* _literals, size_t _literalsSize, size_t _offset, size_t _matchSize)
+		{
+			size_t match = _matchSize != 0 ? _matchSize - LZ4MinMatch : 0;
+			_result.push_back((uint8)(((std::min)(_literalsSize, (size_t)15) << 4) | (std::min)(match, (size_t)15)));
+			if (_literalsSize >= 15)
+				writeLength(_result, _literalsSize - 15);
+			_result.insert(_result.end(), _literals, _literals + _literalsSize);
+
+			// последняя последовательность без совпадения
+			if (_matchSize == 0)
+				return;
+
+			_result.push_back((uint8)(_offset & 0xFF));
+			_result.push_back((uint8)(_offset >> 8));
+			if (match >= 15)
+				writeLength(_result, match - 15);
+		}
+
+		void compressLZ4(const uint8* _data, size_t _size, std::vector<uint8>& _result)
+		{
+			_result.clear();
+			_result.reserve(_size + _size / 255 + 16);
+
+			size_t anchor = 0;
+			if (_size > LZ4MatchLimit)
+			{
+				std::vector<size_t> table((size_t)1 << LZ4HashBits, (size_t)-1);
+				size_t limit = _size - LZ4MatchLimit;
+				size_t matchEnd = _size - LZ4LastLiterals;
+
+				size_t position = 0;
+				while (position < limit)
+				{
+					uint32 sequence = readUInt32(_data + position);
+					size_t hash = (sequence * 2654435761U) >> (32 - LZ4HashBits);
+					size_t candidate = table[hash];
+					table[hash] = position;
+
+					if (candidate == (size_t)-1 || position - candidate > LZ4MaxOffset || readUInt32(_data + candidate) != sequence)
+					{
+						++position;
+						continue;
+					}
+
+					size_t length = LZ4MinMatch;
+					while (position + length < matchEnd && _data[candidate + length] == _data[position + length])
+						++length;
+
+					writeSequence(_result, _data + anchor, position - anchor, position - candidate, length);
+					position += length;
+					anchor = position;
+				}
+			}
+
+			writeSequence(_result, _data + anchor, _size - anchor, 0, 0);
+		}
+
+		bool readLength(const uint8*& _position, const uint8* _end, size_t& _length)
+		{
+			uint8 value = 0;
+			do
+			{
+				if (_position == _end)
+					return false;
+				value = *_position++;
+				_length += value;
+			}
+			while (value == 255);
+			return true;
+		}
+
+		bool decompressLZ4(const uint8* _data, size_t _size, uint8* _result, size_t _resultSize)
+		{
+			const uint8* position = _data;
+			const uint8* end = _data + _size;
+			uint8* output = _result;
+			uint8* outputEnd = _result + _resultSize;
+
+			while (position != end)
+			{
+				uint8 token = *position++;
+
+				size_t literals = token >> 4;
+				if (literals == 15 && !readLength(position, end, literals))
+					return false;
+				if (literals > (size_t)(end - position) || literals > (size_t)(outputEnd - output))
+					return false;
+				::memcpy(output, position, literals);
+				position += literals;
+				output += literals;
+
+				// последняя последовательность
+				if (position == end)
+					break;
+
+				if (end - position < 2)
+					return false;
+				size_t offset = position[0] | (position[1] << 8);
+				position += 2;
+				if (offset == 0 || offset > (size_t)(output - _result))
+					return false;
+
+				size_t length = token & 15;
+				if (length == 15 && !readLength(position, end, length))
+					return false;
+				length += LZ4MinMatch;
+				if (length > (size_t)(outputEnd - output))
+					return false;
+
+				// перекрывающиеся куски копируем по байту, они повторяют последние байты
+				const uint8* match = output - offset;
+				if (offset >= length)
+				{
+					::memcpy(output, match, length);
+				}
+				else
+				{
+					for (size_t index = 0; index < length; ++index)
+						output[index] = match[index];
+				}
+				output += length;
+			}
+
+			return output == outputEnd;
+		}
+
+		//----------------------------------------------------------------------//
+		// отображение файла в память
+		//----------------------------------------------------------------------//
+		const uint8* mapFile(const std::string& _file, size_t& _size, void*& _handle)
+		{
+#if MYGUI_PLATFORM == MYGUI_PLATFORM_WIN32
+			HANDLE file = ::CreateFileW(UString(_file).asWStr_c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+			if (file == INVALID_HANDLE_VALUE)
+				return nullptr;
+
+			LARGE_INTEGER size;
+			if (!::GetFileSizeEx(file, &size) || size.QuadPart == 0 || (unsigned long long)size.QuadPart > (size_t)-1)
+			{
+				::CloseHandle(file);
+				return nullptr;
+			}
+
+			HANDLE mapping = ::CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+			::CloseHandle(file);
+			if (mapping == nullptr)
+				return nullptr;
+
+			void* data = ::MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+			if (data == nullptr)
+			{
+				::CloseHandle(mapping);
+				return nullptr;
+			}
+
+			_size = (size_t)size.QuadPart;
+			_handle = mapping;
+			return static_cast<const uint8*>(data);
+#else
+			int file = ::open(_file.c_str(), O_RDONLY);
+			if (file == -1)
+				return nullptr;
+
+			struct stat info;
+			if (::fstat(file, &info) != 0 || info.st_size == 0)
+			{
+				::close(file);
+				return nullptr;
+			}
+
+			void* data = ::mmap(nullptr, (size_t)info.st_size, PROT_READ, MAP_PRIVATE, file, 0);
+			// отображение остается и после закрытия файла
+			::close(file);
+			if (data == MAP_FAILED)
+				return nullptr;
+
+			_size = (size_t)info.st_size;
+			_handle = nullptr;
+			return static_cast<const uint8*>(data);
+#endif
+		}
+
+		void unmapFile(const uint8* _data, size_t _size, void* _handle)
+		{
+#if MYGUI_PLATFORM == MYGUI_PLATFORM_WIN32
+			::UnmapViewOfFile(_data);
+			::CloseHandle(static_cast<HANDLE>(_handle));
+#else
+			::munmap(const_cast<uint8*>(_data), _size);
+#endif
+		}
+
+	} // namespace
+
+	DataPack::DataPack() :
+		mData(nullptr),
+		mSize(0),
+		mHandle(nullptr)
+	{
+	}
+
+	DataPack::~DataPack()
+	{
+		close();
+	}
+
+	bool DataPack::open(const std::string& _file)
+	{
+		close();
+
+		mData = mapFile(_file, mSize, mHandle);
+		if (mData == nullptr)
+		{
+			MYGUI_LOG(Error, "DataPack : '" << _file << "', can't open file");
+			return false;
+		}
+
+		mFileName = _file;
+		if (!readDirectory())
+		{
+			MYGUI_LOG(Error, "DataPack : '" << _file << "', incorrect pack");
+			close();
+			return false;
+		}
+
+		return true;
+	}
+
+	void DataPack::close()
+	{
+		if (mData != nullptr)
+			unmapFile(mData, mSize, mHandle);
+
+		mData = nullptr;
+		mSize = 0;
+		mHandle = nullptr;
+		mFileName.clear();
+		mEntries.clear();
+		mEntryNames.clear();
+	}
+
+	bool DataPack::readDirectory()
+	{
+		const uint8* position = mData;
+		const uint8* end = mData + mSize;
+
+		if (mSize < PackHeaderSize || ::memcmp(position, PackMagic, PackMagicSize) != 0)
+			return false;
+		position += PackMagicSize;
+
+		size_t version = 0;
+		size_t count = 0;
+		size_t directory = 0;
+		if (!readNumber(position, end, 4, version) || version != PackVersion)
+			return false;
+		if (!readNumber(position, end, 4, count) || !readNumber(position, end, 8, directory) || directory > mSize)
+			return false;
+
+		// число записей из поврежденного файла может быть любым
+		if (count > (mSize - directory) / PackEntryMinSize)
+			return false;
+
+		position = mData + directory;
+		mEntries.resize(count);
+		for (size_t index = 0; index < count; ++index)
+		{
+			Entry& entry = mEntries[index];
+
+			size_t length = 0;
+			size_t method = 0;
+			if (!readNumber(position, end, 2, length) || (size_t)(end - position) < length)
+				return false;
+			entry.name.assign((const char*)position, length);
+			position += length;
+
+			if (!readNumber(position, end, 1, method)
+				|| !readNumber(position, end, 8, entry.offset)
+				|| !readNumber(position, end, 8, entry.packedSize)
+				|| !readNumber(position, end, 8, entry.size))
+				return false;
+			entry.method = (uint8)method;
+
+			if (method > PackMethodLZ4
+				|| entry.offset > directory
+				|| entry.packedSize > directory - entry.offset
+				|| (method == PackMethodStored && entry.packedSize != entry.size)
+				|| (method == PackMethodLZ4 && entry.size / LZ4MaxRatio > entry.packedSize))
+				return false;
+
+			// при повторе имени используется первая запись
+			mEntryNames.insert(MapEntry::value_type(entry.name, index));
+		}
+
+		return true;
+	}
+
+	const std::string& DataPack::getFileName() const
+	{
+		return mFileName;
+	}
+
+	IDataStream* DataPack::getData(const std::string& _name) const
+	{
+		MapEntry::const_iterator item = mEntryNames.find(_name);
+		if (item == mEntryNames.end())
+			return nullptr;
+
+		const Entry& entry = mEntries[item->second];
+		const uint8* data = mData + entry.offset;
+
+		if (entry.method == PackMethodStored)
+			return new DataMemoryStream(const_cast<uint8*>(data), entry.size);
+
+		DataPackStream* stream = new DataPackStream(entry.size);
+		if (!decompressLZ4(data, entry.packedSize, stream->getBuffer(), entry.size))
+		{
+			MYGUI_LOG(Error, "DataPack : '" << mFileName << "', entry '" << _name << "' is corrupted");
+			delete stream;
+			return nullptr;
+		}
+
+		return stream;
+	}
+
+	bool DataPack::isDataExist(const std::string& _name) const
+	{
+		return mEntryNames.find(_name) != mEntryNames.end();
+	}
+
+	void DataPack::getDataListNames(const std::string& _pattern, VectorString& _result) const
+	{
+		for (size_t index = 0; index < mEntries.size(); ++index)
+		{
+			const Entry& entry = mEntries[index];
+			if (isMatch(entry.name.c_str(), _pattern.c_str()))
+				_result.push_back(entry.name);
+		}
+	}
+
+	size_t DataPack::getCount() const
+	{
+		return mEntries.size();
+	}
+
+	bool DataPack::create(const std::string& _file, const VectorString& _sources, bool _compress)
+	{
+		std::ofstream stream;
+		stream.open(_file.c_str(), std::ios_base::out | std::ios_base::binary);
+		if (!stream.is_open())
+		{
+			MYGUI_LOG(Error, "DataPack : '" << _file << "', can't create file");
+			return false;
+		}
+
+		// заголовок пишется после данных, когда известен каталог
+		stream.write(PackMagic, PackMagicSize);
+		writeNumber(stream, 0, PackHeaderSize - PackMagicSize);
+
+		VectorEntry entries;
+		std::set<std::string> names;
+		std::vector<uint8> data;
+		std::vector<uint8> packed;
+		size_t offset = PackHeaderSize;
+
+		for (VectorString::const_iterator source = _sources.begin(); source != _sources.end(); ++source)
+		{
+			size_t separator = source->find_last_of("/\\");
+			std::string name = separator == std::string::npos ? *source : source->substr(separator + 1);
+			if (name.size() > 0xFFFF)
+			{
+				MYGUI_LOG(Error, "DataPack : '" << _file << "', name of '" << *source << "' is too long");
+				return false;
+			}
+			if (!names.insert(name).second)
+			{
+				MYGUI_LOG(Warning, "DataPack : '" << _file << "', '" << *source << "' skipped, entry '" << name << "' already exist");
+				continue;
+			}
+
+			std::ifstream input(source->c_str(), std::ios_base::in | std::ios_base::binary);
+			if (!input.is_open())
+			{
+				MYGUI_LOG(Error, "DataPack : '" << _file << "', can't open '" << *source << "'");
+				return false;
+			}
+			data.assign(std::istreambuf_iterator<char>(input), std::istreambuf_iterator<char>());
+
+			Entry entry;
+			entry.name = name;
+			entry.method = PackMethodStored;
+			entry.offset = offset;
+			entry.size = data.size();
+			entry.packedSize = data.size();
+
+			if (_compress && !data.empty())
+			{
+				compressLZ4(&data[0], data.size(), packed);
+				if (packed.size() < data.size())
+				{
+					entry.method = PackMethodLZ4;
+					entry.packedSize = packed.size();
+					data.swap(packed);
+				}
+			}
+
+			if (!data.empty())
+				stream.write((const char*)&data[0], data.size());
+			offset += data.size();
+			entries.push_back(entry);
+		}
+
+		for (VectorEntry::const_iterator entry = entries.begin(); entry != entries.end(); ++entry)
+		{
+			writeNumber(stream, entry->name.size(), 2);
+			stream.write(entry->name.data(), entry->name.size());
+			writeNumber(stream, entry->method, 1);
+			writeNumber(stream, entry->offset, 8);
+			writeNumber(stream, entry->packedSize, 8);
+			writeNumber(stream, entry->size, 8);
+		}
+
+		stream.seekp(PackMagicSize);
+		writeNumber(stream, PackVersion, 4);
+		writeNumber(stream, entries.size(), 4);
+		writeNumber(stream, offset, 8);
+
+		if (!stream.good())
+		{
+			MYGUI_LOG(Error, "DataPack : '" << _file << "', can't write file");
+			return false;
+		}
+
+		return true;
+	}
+
+} // namespace MyGUI
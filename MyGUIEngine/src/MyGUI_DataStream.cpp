@@ -54,7 +54,8 @@ namespace MyGUI
 		if (mStream == nullptr) return 0;
 		size_t count = std::min(size(), _count);
 		mStream->read((char*)_buf, count);
-		return count;
+		// в текстовом режиме прочитанных символов может быть меньше размера
+		return (size_t)mStream->gcount();
 	}
 
 } // namespace MyGUI
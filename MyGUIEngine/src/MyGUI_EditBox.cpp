@@ -1020,23 +1020,17 @@ namespace MyGUI
 		// нужно ли вставлять цвет
 		bool need_colour = true;
 
-		// цикл прохода по строке
-		while (iterator.moveNext())
+		// доходим до начала диапазона, запоминая цвет
+		bool found = iterator.moveToPosition(_start, &colour);
+
+		// цикл прохода по диапазону
+		while (found)
 		{
 			// текущаяя позиция
 			size_t pos = iterator.getPosition();
 
-			// еще рано
-			if (pos < _start)
-			{
-				// берем цвет из позиции и запоминаем
-				iterator.getTagColour(colour);
-
-				continue;
-			}
-
 			// проверяем на надобность начального тега
-			else if (pos == _start)
+			if (pos == _start)
 			{
 				need_colour = ! iterator.getTagColour(colour);
 				// сохраняем место откуда начинается
@@ -1048,6 +1042,7 @@ namespace MyGUI
 			else if (pos == end)
 				break;
 
+			found = iterator.moveNext();
 		}
 
 		// возвращаем строку
@@ -1073,8 +1068,11 @@ namespace MyGUI
 		// дефолтный цвет
 		UString colour = mClientText == nullptr ? "" : TextIterator::convertTagColour(mClientText->getTextColour());
 
-		// цикл прохода по строке
-		while (iterator.moveNext())
+		// доходим до начала диапазона, запоминая цвет
+		bool found = iterator.moveToPosition(_start, &colour);
+
+		// цикл прохода по диапазону
+		while (found)
 		{
 			// текущаяя позиция
 			size_t pos = iterator.getPosition();
@@ -1082,12 +1080,8 @@ namespace MyGUI
 			// берем цвет из позиции и запоминаем
 			iterator.getTagColour(colour);
 
-			// еще рано
-			if (pos < _start)
-				continue;
-
 			// ставим начальный тег
-			else if (pos == _start)
+			if (pos == _start)
 				iterator.setTagColour(_colour);
 
 			// внутри диапазона очищаем все
@@ -1102,6 +1096,7 @@ namespace MyGUI
 				break;
 			}
 
+			found = iterator.moveNext();
 		}
 
 		// сохраняем позицию для восстановления курсора
@@ -1248,19 +1243,15 @@ namespace MyGUI
 		// потом переделать через TextIterator чтобы отвязать понятие тег от эдита
 		bool need_colour = ( (_text.size() > 6) && (_text[0] == L'#') && (_text[1] != L'#') );
 
-		// цикл прохода по строке
-		while (iterator.moveNext())
+		// доходим до позиции вставки, запоминая цвет
+		if (need_colour)
 		{
-			// текущаяя позиция
-			size_t pos = iterator.getPosition();
-
-			// текущий цвет
-			if (need_colour)
+			if (iterator.moveToPosition(_start, &colour))
 				iterator.getTagColour(colour);
-
-			// если дошли то выходим
-			if (pos == _start)
-				break;
+		}
+		else
+		{
+			iterator.moveToPosition(_start);
 		}
 
 		// если нужен цвет то вставляем
@@ -1331,22 +1322,17 @@ namespace MyGUI
 		size_t end = _start + _count;
 		bool need_colour = false;
 
-		// цикл прохода по строке
-		while (iterator.moveNext())
+		// доходим до начала диапазона, запоминая цвет
+		bool found = iterator.moveToPosition(_start, &colour);
+
+		// цикл прохода по диапазону
+		while (found)
 		{
 			// текущаяя позиция
 			size_t pos = iterator.getPosition();
 
-			// еще рано
-			if (pos < _start)
-			{
-				// берем цвет из позиции и запоминаем
-				iterator.getTagColour(colour);
-				continue;
-			}
-
 			// сохраняем место откуда начинается
-			else if (pos == _start)
+			if (pos == _start)
 			{
 				// если до диапазона был цвет, то нужно закрыть тег
 				if (!colour.empty())
@@ -1378,6 +1364,7 @@ namespace MyGUI
 				break;
 			}
 
+			found = iterator.moveNext();
 		}
 
 		// удаляем диапазон
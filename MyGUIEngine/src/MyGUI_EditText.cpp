@@ -27,6 +27,7 @@ namespace MyGUI
 		mCurrentColourNative(0xFFFFFFFF),
 		mInverseColourNative(0xFF000000),
 		mShadowColourNative(0x00000000),
+		mCaptionLineLength(0),
 		mTextOutDate(false),
 		mTextAlign(Align::Default),
 		mColour(Colour::White),
@@ -49,13 +50,15 @@ namespace MyGUI
 		mShiftText(false),
 		mWordWrap(false),
 		mManualColour(false),
-		mOldWidth(0)
+		mOldWidth(0),
+		mCachedTextView(nullptr)
 	{
 		mVertexFormat = RenderManager::getInstance().getVertexFormat();
 	}
 
 	EditText::~EditText()
 	{
+		releaseCachedTextView();
 	}
 
 	void EditText::setVisible(bool _visible)
@@ -65,13 +68,13 @@ namespace MyGUI
 		mVisible = _visible;
 
 		if (nullptr != mNode)
-			mNode->outOfDate(mRenderItem);
+			mNode->outOfDate(mRenderItem, this);
 	}
 
 	void EditText::_correctView()
 	{
 		if (nullptr != mNode)
-			mNode->outOfDate(mRenderItem);
+			mNode->outOfDate(mRenderItem, this);
 	}
 
 	void EditText::_setAlign(const IntSize& _oldsize)
@@ -158,7 +161,7 @@ namespace MyGUI
 
 				// обновить перед выходом
 				if (nullptr != mNode)
-					mNode->outOfDate(mRenderItem);
+					mNode->outOfDate(mRenderItem, this);
 				return;
 			}
 		}
@@ -173,8 +176,11 @@ namespace MyGUI
 		// запоминаем текущее состояние
 		mIsMargin = margin;
 
+		// видимых строк могло стать больше
+		checkVertexSize();
+
 		if (nullptr != mNode)
-			mNode->outOfDate(mRenderItem);
+			mNode->outOfDate(mRenderItem, this);
 	}
 
 	void EditText::setCaption(const UString& _value)
@@ -182,16 +188,33 @@ namespace MyGUI
 		mCaption = _value;
 		mTextOutDate = true;
 
+		// самая длинная строка текста
+		mCaptionLineLength = 0;
+		size_t length = 0;
+		const UString::code_point* text = mCaption.c_str();
+		for (size_t index = 0; index < mCaption.size(); ++index)
+		{
+			if (text[index] == FontCodeType::CR || text[index] == FontCodeType::LF || text[index] == FontCodeType::NEL)
+				length = 0;
+			else
+				mCaptionLineLength = (std::max)(mCaptionLineLength, ++length);
+		}
+
 		checkVertexSize();
 
 		if (nullptr != mNode)
-			mNode->outOfDate(mRenderItem);
+			mNode->outOfDate(mRenderItem, this);
 	}
 
 	void EditText::checkVertexSize()
 	{
+		// рисуются только видимые строки и по строке запаса сверху и снизу (см. doRender)
+		size_t count = mCaption.size();
+		if (mFontHeight > 0)
+			count = (std::min)(count, ((std::max)(mCurrentCoord.height, 0) / mFontHeight + 4) * mCaptionLineLength);
+
 		// если вершин не хватит, делаем реалок, с учетом выделения * 2 и курсора
-		size_t need = (mCaption.size() * (mShadow ? 3 : 2) + 2) * VERTEX_IN_QUAD;
+		size_t need = (count * (mShadow ? 3 : 2) + 2) * VERTEX_IN_QUAD;
 		if (mCountVertex < need)
 		{
 			mCountVertex = need + SIMPLETEXT_COUNT_VERTEX;
@@ -230,7 +253,7 @@ namespace MyGUI
 		mInverseColourNative = mCurrentColourNative ^ 0x00FFFFFF;
 
 		if (nullptr != mNode)
-			mNode->outOfDate(mRenderItem);
+			mNode->outOfDate(mRenderItem, this);
 	}
 
 	const Colour& EditText::getTextColour() const
@@ -249,7 +272,7 @@ namespace MyGUI
 		mInverseColourNative = mCurrentColourNative ^ 0x00FFFFFF;
 
 		if (nullptr != mNode)
-			mNode->outOfDate(mRenderItem);
+			mNode->outOfDate(mRenderItem, this);
 	}
 
 	float EditText::getAlpha() const
@@ -274,6 +297,8 @@ namespace MyGUI
 
 		mTextOutDate = true;
 
+		checkVertexSize();
+
 		// если мы были приаттаченны, то удаляем себя
 		if (nullptr != mRenderItem)
 		{
@@ -289,7 +314,7 @@ namespace MyGUI
 		}
 
 		if (nullptr != mNode)
-			mNode->outOfDate(mRenderItem);
+			mNode->outOfDate(mRenderItem, this);
 	}
 
 	const std::string& EditText::getFontName() const
@@ -302,8 +327,10 @@ namespace MyGUI
 		mFontHeight = _value;
 		mTextOutDate = true;
 
+		checkVertexSize();
+
 		if (nullptr != mNode)
-			mNode->outOfDate(mRenderItem);
+			mNode->outOfDate(mRenderItem, this);
 	}
 
 	int EditText::getFontHeight() const
@@ -350,7 +377,7 @@ namespace MyGUI
 		mEndSelect = _end;
 
 		if (nullptr != mNode)
-			mNode->outOfDate(mRenderItem);
+			mNode->outOfDate(mRenderItem, this);
 	}
 
 	bool EditText::getSelectBackground() const
@@ -365,7 +392,7 @@ namespace MyGUI
 		mBackgroundNormal = _normal;
 
 		if (nullptr != mNode)
-			mNode->outOfDate(mRenderItem);
+			mNode->outOfDate(mRenderItem, this);
 	}
 
 	bool EditText::isVisibleCursor() const
@@ -380,7 +407,7 @@ namespace MyGUI
 		mVisibleCursor = _value;
 
 		if (nullptr != mNode)
-			mNode->outOfDate(mRenderItem);
+			mNode->outOfDate(mRenderItem, this);
 	}
 
 	size_t EditText::getCursorPosition() const
@@ -395,7 +422,7 @@ namespace MyGUI
 		mCursorPosition = _index;
 
 		if (nullptr != mNode)
-			mNode->outOfDate(mRenderItem);
+			mNode->outOfDate(mRenderItem, this);
 	}
 
 	void EditText::setTextAlign(Align _value)
@@ -403,7 +430,7 @@ namespace MyGUI
 		mTextAlign = _value;
 
 		if (nullptr != mNode)
-			mNode->outOfDate(mRenderItem);
+			mNode->outOfDate(mRenderItem, this);
 	}
 
 	Align EditText::getTextAlign() const
@@ -417,7 +444,7 @@ namespace MyGUI
 		if (mTextOutDate)
 			updateRawData();
 
-		IntSize size = mTextView.getViewSize();
+		IntSize size = getTextView().getViewSize();
 		// плюс размер курсора
 		if (mIsAddCursorWidth)
 			size.width += 2;
@@ -434,7 +461,7 @@ namespace MyGUI
 
 	const VectorLineInfo& EditText::getLineInfo() const
 	{
-		return mTextView.getData();
+		return getTextView().getData();
 	}
 
 	void EditText::setViewOffset(const IntPoint& _point)
@@ -442,7 +469,7 @@ namespace MyGUI
 		mViewOffset = _point;
 
 		if (nullptr != mNode)
-			mNode->outOfDate(mRenderItem);
+			mNode->outOfDate(mRenderItem, this);
 	}
 
 	IntPoint EditText::getViewOffset() const
@@ -463,7 +490,7 @@ namespace MyGUI
 		point += mViewOffset;
 		point -= mCoord.point();
 
-		return mTextView.getCursorPosition(point);
+		return getTextView().getCursorPosition(point);
 	}
 
 	IntCoord EditText::getCursorCoord(size_t _position)
@@ -474,7 +501,7 @@ namespace MyGUI
 		if (mTextOutDate)
 			updateRawData();
 
-		IntPoint point = mTextView.getCursorPoint(_position);
+		IntPoint point = getTextView().getCursorPoint(_position);
 		point += mCroppedParent->getAbsolutePosition();
 		point -= mViewOffset;
 		point += mCoord.point();
@@ -489,7 +516,7 @@ namespace MyGUI
 		mShiftText = _value;
 
 		if (nullptr != mNode)
-			mNode->outOfDate(mRenderItem);
+			mNode->outOfDate(mRenderItem, this);
 	}
 
 	void EditText::setWordWrap(bool _value)
@@ -498,7 +525,7 @@ namespace MyGUI
 		mTextOutDate = true;
 
 		if (nullptr != mNode)
-			mNode->outOfDate(mRenderItem);
+			mNode->outOfDate(mRenderItem, this);
 	}
 
 	void EditText::updateRawData()
@@ -517,7 +544,38 @@ namespace MyGUI
 				width -= 2;
 		}
 
-		mTextView.update(mCaption, mFont, mFontHeight, mTextAlign, mVertexFormat, width);
+		// короткий текст берем из общего кеша, длинный раскладываем сами по изменившимся строкам
+		TextLayoutCache& cache = FontManager::getInstance().getTextLayoutCache();
+		if (mCaption.size() <= cache.getMaxTextLength())
+		{
+			const TextView* view = cache.acquire(mCaption, mFont, mFontHeight, mTextAlign, mVertexFormat, width);
+			releaseCachedTextView();
+			mCachedTextView = view;
+			if (!mTextView.getData().empty())
+				mTextView = TextView();
+		}
+		else
+		{
+			releaseCachedTextView();
+			mTextView.update(mCaption, mFont, mFontHeight, mTextAlign, mVertexFormat, width);
+		}
+	}
+
+	const TextView& EditText::getTextView() const
+	{
+		return mCachedTextView != nullptr ? *mCachedTextView : mTextView;
+	}
+
+	void EditText::releaseCachedTextView()
+	{
+		if (mCachedTextView == nullptr)
+			return;
+
+		// кеш мог быть уже удален вместе с менеджером
+		FontManager* manager = FontManager::getInstancePtr();
+		if (manager != nullptr)
+			manager->getTextLayoutCache().release(mCachedTextView);
+		mCachedTextView = nullptr;
 	}
 
 	void EditText::setStateData(IStateInfo* _data)
@@ -533,6 +591,10 @@ namespace MyGUI
 		if (nullptr == mFont || !mVisible || mEmptyView)
 			return;
 
+		// при полном обновлении глифы шрифта могли измениться
+		if (mRenderItem->getCurrentUpdate())
+			mTextView.invalidate();
+
 		if (mRenderItem->getCurrentUpdate() || mTextOutDate)
 			updateRawData();
 
@@ -548,7 +610,7 @@ namespace MyGUI
 		uint32 inverseColour = mInverseColourNative;
 		uint32 selectedColour = mInvertSelect ? inverseColour : colour | 0x00FFFFFF;
 
-		const VectorLineInfo& textViewData = mTextView.getData();
+		const VectorLineInfo& textViewData = getTextView().getData();
 
 		float top = (float)(-mViewOffset.top + mCoord.top);
 
@@ -558,8 +620,38 @@ namespace MyGUI
 
 		size_t index = 0;
 
-		for (VectorLineInfo::const_iterator line = textViewData.begin(); line != textViewData.end(); ++line)
+		VectorLineInfo::const_iterator line = textViewData.begin();
+		float bottom = (std::numeric_limits<float>::max)();
+
+		// строки выше видимой области пропускаем, оставляя строку запаса для выступающих глифов
+		if (mFontHeight > 0)
+		{
+			int skip = (mViewOffset.top + mCurrentCoord.top - mCoord.top) / mFontHeight - 1;
+			if (skip > 0 && !textViewData.empty())
+			{
+				size_t first = (std::min)((size_t)skip, textViewData.size() - 1);
+				line += first;
+				top += (float)(first * mFontHeight);
+				index = getTextView().getLinePosition(first);
+
+				const CharInfo* lineColour = getTextView().getLineColour(first);
+				if (lineColour != nullptr)
+				{
+					colour = lineColour->getColour() | (colour & 0xFF000000);
+					inverseColour = colour ^ 0x00FFFFFF;
+					selectedColour = mInvertSelect ? inverseColour : colour | 0x00FFFFFF;
+				}
+			}
+
+			bottom = (float)(mCurrentCoord.bottom() + mFontHeight);
+		}
+
+		for (; line != textViewData.end(); ++line)
 		{
+			// строки ниже видимой области тоже
+			if (top >= bottom)
+				break;
+
 			float left = (float)(line->offset - mViewOffset.left + mCoord.left);
 
 			for (VectorCharInfo::const_iterator sim = line->simbols.begin(); sim != line->simbols.end(); ++sim)
@@ -615,7 +707,7 @@ namespace MyGUI
 		// Render the cursor, if any, last.
 		if (mVisibleCursor)
 		{
-			IntPoint point = mTextView.getCursorPoint(mCursorPosition) - mViewOffset + mCoord.point();
+			IntPoint point = getTextView().getCursorPoint(mCursorPosition) - mViewOffset + mCoord.point();
 			GlyphInfo* cursorGlyph = mFont->getGlyphInfo(static_cast<Char>(FontCodeType::Cursor));
 			vertexRect.set((float)point.left, (float)point.top, (float)point.left + cursorGlyph->width, (float)(point.top + mFontHeight));
 
@@ -633,7 +725,7 @@ namespace MyGUI
 		mInvertSelect = _value;
 
 		if (nullptr != mNode)
-			mNode->outOfDate(mRenderItem);
+			mNode->outOfDate(mRenderItem, this);
 	}
 
 	bool EditText::getInvertSelected() const
@@ -654,7 +746,7 @@ namespace MyGUI
 		checkVertexSize();
 
 		if (nullptr != mNode)
-			mNode->outOfDate(mRenderItem);
+			mNode->outOfDate(mRenderItem, this);
 	}
 
 	void EditText::setShadowColour(const Colour& _value)
@@ -667,7 +759,7 @@ namespace MyGUI
 		mShadowColourNative = (mShadowColourNative & 0x00FFFFFF) | getMixedNativeAlpha(mShadowColour.alpha);
 
 		if (nullptr != mNode)
-			mNode->outOfDate(mRenderItem);
+			mNode->outOfDate(mRenderItem, this);
 	}
 
 	const Colour& EditText::getShadowColour() const
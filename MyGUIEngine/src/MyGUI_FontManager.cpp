@@ -54,6 +54,8 @@ namespace MyGUI
 		FactoryManager::getInstance().unregisterFactory<ResourceManualFont>(resourceCategory);
 		FactoryManager::getInstance().unregisterFactory<ResourceTrueTypeFont>(resourceCategory);
 
+		mTextLayoutCache.clear();
+
 		MYGUI_LOG(Info, getClassTypeName() << " successfully shutdown");
 		mIsInitialise = false;
 	}
@@ -105,6 +107,11 @@ namespace MyGUI
 		return result ? result->castType<IFont>(false) : nullptr;
 	}
 
+	TextLayoutCache& FontManager::getTextLayoutCache()
+	{
+		return mTextLayoutCache;
+	}
+
 	const std::string& FontManager::getDefaultFont() const
 	{
 		return mDefaultName;
@@ -0,0 +1,71 @@
+/*
+ * This source file is part of MyGUI. For the latest info, see http://mygui.info/
+ * Distributed under the MIT License
+ * (See accompanying file COPYING.MIT or copy at http://opensource.org/licenses/MIT)
+ */
+
+#include "MyGUI_Precompiled.h"
+#include "MyGUI_FrameStatistics.h"
+#include "MyGUI_RenderManager.h"
+#include "MyGUI_Timer.h"
+
+namespace MyGUI
+{
+
+	FrameStatistics::FrameStatistics()
+	{
+		clear();
+	}
+
+	void FrameStatistics::clear()
+	{
+		drawCalls = 0;
+		textureBinds = 0;
+		layers.clear();
+		verticesRegenerated = 0;
+		verticesReused = 0;
+		vertexBufferReallocations = 0;
+		widgetsCreated = 0;
+		widgetsDestroyed = 0;
+		textViewUpdates = 0;
+		textLayoutCacheHits = 0;
+		frameEventTime = 0;
+		controllersTime = 0;
+		inputPickingTime = 0;
+		vertexGenerationTime = 0;
+		submissionTime = 0;
+	}
+
+	void FrameStatistics::addLayerBatches(const std::string& _name, size_t _batches)
+	{
+		for (VectorLayerStatistics::iterator item = layers.begin(); item != layers.end(); ++item)
+		{
+			if ((*item).name == _name)
+			{
+				(*item).batches += _batches;
+				return;
+			}
+		}
+
+		layers.push_back(LayerStatistics(_name, _batches));
+	}
+
+	FrameTimingScope::FrameTimingScope(size_t FrameStatistics::* _phase) :
+		mTime(nullptr),
+		mStart(0)
+	{
+		RenderManager* render = RenderManager::getInstancePtr();
+		if (render != nullptr && render->getFrameTiming())
+		{
+			mTime = &(render->_getFrameStatistics().*_phase);
+			mStart = Timer::getCurrentMicroseconds();
+		}
+	}
+
+	FrameTimingScope::~FrameTimingScope()
+	{
+		if (mTime != nullptr)
+			*mTime += Timer::getCurrentMicroseconds() - mStart;
+	}
+
+} // namespace MyGUI
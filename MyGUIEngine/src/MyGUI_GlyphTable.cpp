@@ -0,0 +1,77 @@
+/*
+ * This source file is part of MyGUI. For the latest info, see http://mygui.info/
+ * Distributed under the MIT License
+ * (See accompanying file COPYING.MIT or copy at http://opensource.org/licenses/MIT)
+ */
+
+#include "MyGUI_Precompiled.h"
+#include "MyGUI_GlyphTable.h"
+
+namespace MyGUI
+{
+
+	// highest Unicode code point, higher code points are kept in map
+	const Char GLYPH_TABLE_MAX_CODE_POINT = 0x10FFFF;
+
+	GlyphTable::GlyphTable()
+	{
+		std::fill(mEmptyPage.glyphs, mEmptyPage.glyphs + PageSize, static_cast<GlyphInfo*>(nullptr));
+	}
+
+	GlyphTable::~GlyphTable()
+	{
+		clear();
+	}
+
+	void GlyphTable::insert(Char _codePoint, GlyphInfo* _info)
+	{
+		if (_codePoint > GLYPH_TABLE_MAX_CODE_POINT)
+		{
+			mOther[_codePoint] = _info;
+			return;
+		}
+
+		size_t page = _codePoint >> PageBits;
+		if (page >= mPages.size())
+			mPages.resize(page + 1, &mEmptyPage);
+
+		if (mPages[page] == &mEmptyPage)
+			mPages[page] = new Page(mEmptyPage);
+
+		mPages[page]->glyphs[_codePoint & PageMask] = _info;
+	}
+
+	void GlyphTable::erase(Char _codePoint)
+	{
+		size_t page = _codePoint >> PageBits;
+		if (page < mPages.size())
+		{
+			// empty page keeps nullptr
+			if (mPages[page] != &mEmptyPage)
+				mPages[page]->glyphs[_codePoint & PageMask] = nullptr;
+		}
+		else
+		{
+			mOther.erase(_codePoint);
+		}
+	}
+
+	void GlyphTable::clear()
+	{
+		for (std::vector<Page*>::iterator page = mPages.begin(); page != mPages.end(); ++page)
+		{
+			if (*page != &mEmptyPage)
+				delete *page;
+		}
+
+		mPages.clear();
+		mOther.clear();
+	}
+
+	GlyphInfo* GlyphTable::findOther(Char _codePoint) const
+	{
+		std::map<Char, GlyphInfo*>::const_iterator item = mOther.find(_codePoint);
+		return item != mOther.end() ? item->second : nullptr;
+	}
+
+} // namespace MyGUI
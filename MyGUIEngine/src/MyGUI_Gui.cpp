@@ -6,6 +6,7 @@
 
 #include "MyGUI_Precompiled.h"
 #include "MyGUI_Gui.h"
+#include "MyGUI_Profiler.h"
 #include "MyGUI_Widget.h"
 
 #include "MyGUI_InputManager.h"
@@ -325,6 +326,7 @@ namespace MyGUI
 
 	void Gui::frameEvent(float _time)
 	{
+		MYGUI_PROFILE_ZONE("Gui::frameEvent");
 		eventFrameStart(_time);
 	}
 
@@ -6,6 +6,7 @@
 
 #include "MyGUI_Precompiled.h"
 #include "MyGUI_InputManager.h"
+#include "MyGUI_Profiler.h"
 #include "MyGUI_Widget.h"
 #include "MyGUI_WidgetManager.h"
 #include "MyGUI_Gui.h"
@@ -81,6 +82,7 @@ namespace MyGUI
 
 	bool InputManager::injectMouseMove(int _absx, int _absy, int _absz)
 	{
+		MYGUI_PROFILE_ZONE("InputManager::injectMouseMove");
 		// запоминаем позицию
 		mMousePosition.set(_absx, _absy);
 
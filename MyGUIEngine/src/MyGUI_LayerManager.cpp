@@ -211,6 +211,8 @@ namespace MyGUI
 
 	Widget* LayerManager::getWidgetFromPoint(int _left, int _top)
 	{
+		FrameTimingScope timing(&FrameStatistics::inputPickingTime);
+
 		VectorLayer::reverse_iterator iter = mLayerNodes.rbegin();
 		while (iter != mLayerNodes.rend())
 		{
@@ -223,9 +225,13 @@ namespace MyGUI
 
 	void LayerManager::renderToTarget(IRenderTarget* _target, bool _update)
 	{
+		FrameStatistics& statistics = RenderManager::getInstance()._getFrameStatistics();
+
 		for (VectorLayer::iterator iter = mLayerNodes.begin(); iter != mLayerNodes.end(); ++iter)
 		{
+			size_t drawCalls = statistics.drawCalls;
 			(*iter)->renderToTarget(_target, _update);
+			statistics.addLayerBatches((*iter)->getName(), statistics.drawCalls - drawCalls);
 		}
 	}
 
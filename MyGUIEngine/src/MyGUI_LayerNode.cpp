@@ -6,6 +6,7 @@
 
 #include "MyGUI_Precompiled.h"
 #include "MyGUI_LayerNode.h"
+#include "MyGUI_Profiler.h"
 #include "MyGUI_ILayerItem.h"
 #include "MyGUI_ITexture.h"
 #include "MyGUI_ISubWidget.h"
@@ -85,6 +86,7 @@ namespace MyGUI
 
 	void LayerNode::renderToTarget(IRenderTarget* _target, bool _update)
 	{
+		MYGUI_PROFILE_ZONE("LayerNode::renderToTarget");
 		mDepth = _target->getInfo().maximumDepth;
 
 		if (mOutOfDateCompression)
@@ -251,6 +253,13 @@ namespace MyGUI
 			_item->outOfDate();
 	}
 
+	void LayerNode::outOfDate(RenderItem* _item, ISubWidget* _drawItem)
+	{
+		mOutOfDate = true;
+		if (_item)
+			_item->outOfDate(_drawItem);
+	}
+
 	EnumeratorILayerNode LayerNode::getEnumerator() const
 	{
 		return EnumeratorILayerNode(mChildItems);
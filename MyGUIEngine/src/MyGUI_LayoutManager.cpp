@@ -6,6 +6,7 @@
 
 #include "MyGUI_Precompiled.h"
 #include "MyGUI_LayoutManager.h"
+#include "MyGUI_Profiler.h"
 #include "MyGUI_ResourceManager.h"
 #include "MyGUI_FactoryManager.h"
 #include "MyGUI_WidgetManager.h"
@@ -58,6 +59,7 @@ namespace MyGUI
 
 	VectorWidgetPtr LayoutManager::loadLayout(const std::string& _file, const std::string& _prefix, Widget* _parent)
 	{
+		MYGUI_PROFILE_ZONE("LayoutManager::loadLayout");
 		mCurrentLayoutName = _file;
 
 		ResourceLayout* resource = getByName(_file, false);
@@ -0,0 +1,124 @@
+/*
+ * This source file is part of MyGUI. For the latest info, see http://mygui.info/
+ * Distributed under the MIT License
+ * (See accompanying file COPYING.MIT or copy at http://opensource.org/licenses/MIT)
+ */
+
+#include "MyGUI_Precompiled.h"
+#include "MyGUI_PackDataManager.h"
+#include "MyGUI_DataPack.h"
+#include <set>
+
+namespace MyGUI
+{
+
+	PackDataManager::PackDataManager() :
+		mIsInitialise(false)
+	{
+	}
+
+	PackDataManager::~PackDataManager()
+	{
+		for (VectorDataPack::iterator item = mPacks.begin(); item != mPacks.end(); ++item)
+			delete *item;
+		mPacks.clear();
+	}
+
+	void PackDataManager::initialise()
+	{
+		MYGUI_ASSERT(!mIsInitialise, getClassTypeName() << " initialised twice");
+		MYGUI_LOG(Info, "* Initialise: " << getClassTypeName());
+
+		MYGUI_LOG(Info, getClassTypeName() << " successfully initialized");
+		mIsInitialise = true;
+	}
+
+	void PackDataManager::shutdown()
+	{
+		MYGUI_ASSERT(mIsInitialise, getClassTypeName() << " is not initialised");
+		MYGUI_LOG(Info, "* Shutdown: " << getClassTypeName());
+
+		MYGUI_LOG(Info, getClassTypeName() << " successfully shutdown");
+		mIsInitialise = false;
+	}
+
+	IDataStream* PackDataManager::getData(const std::string& _name)
+	{
+		for (VectorDataPack::const_iterator item = mPacks.begin(); item != mPacks.end(); ++item)
+		{
+			if ((*item)->isDataExist(_name))
+				return (*item)->getData(_name);
+		}
+		return nullptr;
+	}
+
+	void PackDataManager::freeData(IDataStream* _data)
+	{
+		delete _data;
+	}
+
+	bool PackDataManager::isDataExist(const std::string& _name)
+	{
+		for (VectorDataPack::const_iterator item = mPacks.begin(); item != mPacks.end(); ++item)
+		{
+			if ((*item)->isDataExist(_name))
+				return true;
+		}
+		return false;
+	}
+
+	const VectorString& PackDataManager::getDataListNames(const std::string& _pattern)
+	{
+		static VectorString result;
+		result.clear();
+
+		// имя в нескольких паках выдается один раз, как у getData первый пак важнее
+		std::set<std::string> names;
+		VectorString packNames;
+		for (VectorDataPack::const_iterator item = mPacks.begin(); item != mPacks.end(); ++item)
+		{
+			packNames.clear();
+			(*item)->getDataListNames(_pattern, packNames);
+
+			for (VectorString::const_iterator name = packNames.begin(); name != packNames.end(); ++name)
+			{
+				if (names.insert(*name).second)
+					result.push_back(*name);
+			}
+		}
+
+		return result;
+	}
+
+	const std::string& PackDataManager::getDataPath(const std::string& _name)
+	{
+		static std::string path;
+		path.clear();
+
+		for (VectorDataPack::const_iterator item = mPacks.begin(); item != mPacks.end(); ++item)
+		{
+			if ((*item)->isDataExist(_name))
+			{
+				path = (*item)->getFileName() + "/" + _name;
+				break;
+			}
+		}
+
+		return path;
+	}
+
+	bool PackDataManager::addPack(const std::string& _file)
+	{
+		DataPack* pack = new DataPack();
+		if (!pack->open(_file))
+		{
+			delete pack;
+			return false;
+		}
+
+		MYGUI_LOG(Info, getClassTypeName() << " : pack '" << _file << "' added, " << pack->getCount() << " entries");
+		mPacks.push_back(pack);
+		return true;
+	}
+
+} // namespace MyGUI
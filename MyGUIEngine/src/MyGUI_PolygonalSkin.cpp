@@ -105,7 +105,7 @@ namespace MyGUI
 		mGeometryOutdated = true;
 
 		if (nullptr != mNode)
-			mNode->outOfDate(mRenderItem);
+			mNode->outOfDate(mRenderItem, this);
 	}
 
 	void PolygonalSkin::setAlpha(float _alpha)
@@ -114,7 +114,7 @@ namespace MyGUI
 		mCurrentColour = (mCurrentColour & 0x00FFFFFF) | (alpha & 0xFF000000);
 
 		if (nullptr != mNode)
-			mNode->outOfDate(mRenderItem);
+			mNode->outOfDate(mRenderItem, this);
 	}
 
 	void PolygonalSkin::_correctView()
@@ -122,7 +122,7 @@ namespace MyGUI
 		mGeometryOutdated = true;
 
 		if (nullptr != mNode)
-			mNode->outOfDate(mRenderItem);
+			mNode->outOfDate(mRenderItem, this);
 	}
 
 	void PolygonalSkin::_setAlign(const IntSize& _oldsize)
@@ -200,7 +200,7 @@ namespace MyGUI
 
 				// обновить перед выходом
 				if (nullptr != mNode)
-					mNode->outOfDate(mRenderItem);
+					mNode->outOfDate(mRenderItem, this);
 				return;
 			}
 		}
@@ -216,7 +216,7 @@ namespace MyGUI
 		mIsMargin = margin;
 
 		if (nullptr != mNode)
-			mNode->outOfDate(mRenderItem);
+			mNode->outOfDate(mRenderItem, this);
 	}
 
 	void PolygonalSkin::createDrawItem(ITexture* _texture, ILayerNode* _node)
@@ -272,7 +272,7 @@ namespace MyGUI
 		mCurrentColour = (colour & 0x00FFFFFF) | (mCurrentColour & 0xFF000000);
 
 		if (nullptr != mNode)
-			mNode->outOfDate(mRenderItem);
+			mNode->outOfDate(mRenderItem, this);
 	}
 
 	void PolygonalSkin::setStateData(IStateInfo* _data)
@@ -287,7 +287,7 @@ namespace MyGUI
 		mGeometryOutdated = true;
 
 		if (nullptr != mNode)
-			mNode->outOfDate(mRenderItem);
+			mNode->outOfDate(mRenderItem, this);
 	}
 
 	void PolygonalSkin::_rebuildGeometry()
@@ -0,0 +1,127 @@
+/*
+ * This source file is part of MyGUI. For the latest info, see http://mygui.info/
+ * Distributed under the MIT License
+ * (See accompanying file COPYING.MIT or copy at http://opensource.org/licenses/MIT)
+ */
+
+#include "MyGUI_Precompiled.h"
+#include "MyGUI_Profiler.h"
+#include "MyGUI_Timer.h"
+#include <fstream>
+
+namespace MyGUI
+{
+
+	template <> Profiler* Singleton<Profiler>::msInstance = nullptr;
+	template <> const char* Singleton<Profiler>::mClassTypeName = "Profiler";
+
+	Profiler::Profiler(size_t _capacity) :
+		mNext(0),
+		mCount(0),
+		mEnabled(true),
+		mClock(&Timer::getCurrentMicroseconds),
+		mProcessId(0),
+		mThreadId(0)
+	{
+		mZones.resize((std::max)(_capacity, (size_t)1));
+	}
+
+	void Profiler::setEnabled(bool _value)
+	{
+		mEnabled = _value;
+	}
+
+	bool Profiler::getEnabled() const
+	{
+		return mEnabled;
+	}
+
+	void Profiler::setClock(ClockFunction _value)
+	{
+		MYGUI_ASSERT(_value != nullptr, "Profiler clock can't be null");
+		mClock = _value;
+	}
+
+	Profiler::ClockFunction Profiler::getClock() const
+	{
+		return mClock;
+	}
+
+	void Profiler::setTraceIds(size_t _processId, size_t _threadId)
+	{
+		mProcessId = _processId;
+		mThreadId = _threadId;
+	}
+
+	void Profiler::clear()
+	{
+		mNext = 0;
+		mCount = 0;
+	}
+
+	size_t Profiler::getZoneCount() const
+	{
+		return mCount;
+	}
+
+	void Profiler::_addZone(const char* _name, unsigned long _start, unsigned long _duration)
+	{
+		Zone& zone = mZones[mNext];
+		zone.name = _name;
+		zone.start = _start;
+		zone.duration = _duration;
+
+		mNext = (mNext + 1) % mZones.size();
+		if (mCount < mZones.size())
+			++mCount;
+	}
+
+	void Profiler::writeChromeTrace(std::ostream& _stream) const
+	{
+		_stream << "{\"traceEvents\":[";
+
+		// oldest zone first
+		size_t first = (mNext + mZones.size() - mCount) % mZones.size();
+		for (size_t index = 0; index < mCount; ++index)
+		{
+			const Zone& zone = mZones[(first + index) % mZones.size()];
+			if (index != 0)
+				_stream << ",";
+			_stream << "\n{\"name\":\"" << zone.name << "\",\"cat\":\"MyGUI\",\"ph\":\"X\",\"ts\":" << zone.start
+				<< ",\"dur\":" << zone.duration << ",\"pid\":" << mProcessId << ",\"tid\":" << mThreadId << "}";
+		}
+
+		_stream << "\n],\"displayTimeUnit\":\"ms\"}\n";
+	}
+
+	bool Profiler::saveChromeTrace(const std::string& _fileName) const
+	{
+		std::ofstream stream(_fileName.c_str(), std::ios_base::out | std::ios_base::binary);
+		if (!stream.is_open())
+		{
+			MYGUI_LOG(Error, "Profiler: can't write trace '" << _fileName << "'");
+			return false;
+		}
+
+		writeChromeTrace(stream);
+		return true;
+	}
+
+	ProfileZone::ProfileZone(const char* _name) :
+		mProfiler(Profiler::getInstancePtr()),
+		mName(_name),
+		mStart(0)
+	{
+		if (mProfiler != nullptr && mProfiler->getEnabled())
+			mStart = mProfiler->getClock()();
+		else
+			mProfiler = nullptr;
+	}
+
+	ProfileZone::~ProfileZone()
+	{
+		if (mProfiler != nullptr)
+			mProfiler->_addZone(mName, mStart, mProfiler->getClock()() - mStart);
+	}
+
+} // namespace MyGUI
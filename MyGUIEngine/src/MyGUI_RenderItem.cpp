@@ -6,6 +6,7 @@
 
 #include "MyGUI_Precompiled.h"
 #include "MyGUI_RenderItem.h"
+#include "MyGUI_Profiler.h"
 #include "MyGUI_LayerNode.h"
 #include "MyGUI_LayerManager.h"
 #include "MyGUI_Gui.h"
@@ -20,6 +21,7 @@ namespace MyGUI
 		mTexture(nullptr),
 		mNeedVertexCount(0),
 		mOutOfDate(false),
+		mOutOfDateDrawItems(0),
 		mCountVertex(0),
 		mCurrentUpdate(true),
 		mCurrentVertex(nullptr),
@@ -40,6 +42,7 @@ namespace MyGUI
 
 	void RenderItem::renderToTarget(IRenderTarget* _target, bool _update)
 	{
+		MYGUI_PROFILE_ZONE("RenderItem::renderToTarget");
 		if (mTexture == nullptr)
 			return;
 
@@ -47,32 +50,33 @@ namespace MyGUI
 
 		mCurrentUpdate = _update;
 
-		if (mOutOfDate || _update)
-		{
-			mCountVertex = 0;
-			Vertex* buffer = mVertexBuffer->lock();
-			if (buffer != nullptr)
-			{
-				for (VectorDrawItem::iterator iter = mDrawItems.begin(); iter != mDrawItems.end(); ++iter)
-				{
-					// перед вызовом запоминаем позицию в буфере
-					mCurrentVertex = buffer;
-					mLastVertexCount = 0;
+		RenderManager& render = RenderManager::getInstance();
+		FrameStatistics& statistics = render._getFrameStatistics();
+		size_t regenerated = statistics.verticesRegenerated;
 
-					(*iter).first->doRender();
+		// слишком большой буфер уменьшается при полном заполнении
+		if (!mOutOfDate && mVertexBuffer->checkShrink())
+			mOutOfDate = true;
 
-					// колличество отрисованных вершин
-					MYGUI_DEBUG_ASSERT(mLastVertexCount <= (*iter).second, "It is too much vertexes");
-					buffer += mLastVertexCount;
-					mCountVertex += mLastVertexCount;
-				}
+		if (mOutOfDate || _update || mOutOfDateDrawItems != 0)
+		{
+			FrameTimingScope timing(&FrameStatistics::vertexGenerationTime);
 
-				mVertexBuffer->unlock();
+			if (mOutOfDate || _update)
+			{
+				updateAllDrawItems();
+			}
+			else
+			{
+				if (!updateOutOfDateDrawItems())
+					updateAllDrawItems();
 			}
-
-			mOutOfDate = false;
 		}
 
+		regenerated = statistics.verticesRegenerated - regenerated;
+		if (mCountVertex > regenerated)
+			statistics.verticesReused += mCountVertex - regenerated;
+
 		// хоть с 0 не выводиться батч, но все равно не будем дергать стейт и операцию
 		if (0 != mCountVertex)
 		{
@@ -84,11 +88,14 @@ namespace MyGUI
 				return;
 			}
 #endif
+			FrameTimingScope timing(&FrameStatistics::submissionTime);
+			render._notifyBatchRendered(mTexture);
+
 			// непосредственный рендринг
 			if (mManualRender)
 			{
 				for (VectorDrawItem::iterator iter = mDrawItems.begin(); iter != mDrawItems.end(); ++iter)
-					(*iter).first->doManualRender(mVertexBuffer, mTexture, mCountVertex);
+					(*iter).item->doManualRender(mVertexBuffer, mTexture, mCountVertex);
 			}
 			else
 			{
@@ -97,13 +104,122 @@ namespace MyGUI
 		}
 	}
 
+	void RenderItem::updateAllDrawItems()
+	{
+		mCountVertex = 0;
+		Vertex* buffer = mVertexBuffer->lock();
+		if (buffer != nullptr)
+		{
+			for (VectorDrawItem::iterator iter = mDrawItems.begin(); iter != mDrawItems.end(); ++iter)
+				mCountVertex += renderDrawItem(*iter, buffer + mCountVertex, mCountVertex);
+
+			mVertexBuffer->unlock();
+		}
+
+		mOutOfDate = false;
+		mOutOfDateDrawItems = 0;
+	}
+
+	bool RenderItem::updateOutOfDateDrawItems()
+	{
+		// range that covers all vertices out of date items are allowed to write
+		size_t first = mDrawItems.size();
+		size_t start = 0;
+		size_t end = 0;
+		for (size_t index = 0; index < mDrawItems.size(); ++index)
+		{
+			const DrawItemInfo& info = mDrawItems[index];
+			if (!info.outOfDate)
+				continue;
+
+			if (first == mDrawItems.size())
+			{
+				first = index;
+				start = info.offset;
+			}
+			end = (std::max)(end, info.offset + info.count);
+		}
+
+		if (first == mDrawItems.size() || end <= start)
+			return false;
+
+		Vertex* buffer = mVertexBuffer->lockRange(start, end - start);
+		if (buffer == nullptr)
+			return false;
+
+		size_t index = first;
+		for (; index < mDrawItems.size(); ++index)
+		{
+			DrawItemInfo& info = mDrawItems[index];
+			if (!info.outOfDate)
+				continue;
+
+			size_t oldCount = info.vertexCount;
+			renderDrawItem(info, buffer + (info.offset - start), info.offset);
+
+			// vertex count changed, all following items have to be moved
+			if (info.vertexCount != oldCount)
+				break;
+		}
+
+		mVertexBuffer->unlock();
+
+		if (index < mDrawItems.size())
+		{
+			const DrawItemInfo& changed = mDrawItems[index];
+			size_t tailStart = changed.offset + changed.vertexCount;
+
+			if (index + 1 < mDrawItems.size())
+			{
+				if (tailStart >= mNeedVertexCount)
+					return false;
+
+				buffer = mVertexBuffer->lockRange(tailStart, mNeedVertexCount - tailStart);
+				if (buffer == nullptr)
+					return false;
+
+				size_t offset = tailStart;
+				for (++index; index < mDrawItems.size(); ++index)
+					offset += renderDrawItem(mDrawItems[index], buffer + (offset - tailStart), offset);
+
+				mVertexBuffer->unlock();
+				tailStart = offset;
+			}
+
+			mCountVertex = tailStart;
+		}
+
+		mOutOfDateDrawItems = 0;
+		return true;
+	}
+
+	size_t RenderItem::renderDrawItem(DrawItemInfo& _info, Vertex* _buffer, size_t _offset)
+	{
+		// перед вызовом запоминаем позицию в буфере
+		mCurrentVertex = _buffer;
+		mLastVertexCount = 0;
+
+		_info.item->doRender();
+
+		// колличество отрисованных вершин
+		MYGUI_DEBUG_ASSERT(mLastVertexCount <= _info.count, "It is too much vertexes");
+
+		RenderManager::getInstance()._getFrameStatistics().verticesRegenerated += mLastVertexCount;
+
+		_info.offset = _offset;
+		_info.vertexCount = mLastVertexCount;
+		_info.outOfDate = false;
+
+		return mLastVertexCount;
+	}
+
 	void RenderItem::removeDrawItem(ISubWidget* _item)
 	{
 		for (VectorDrawItem::iterator iter = mDrawItems.begin(); iter != mDrawItems.end(); ++iter)
 		{
-			if ((*iter).first == _item)
+			if ((*iter).item == _item)
 			{
-				mNeedVertexCount -= (*iter).second;
+				mNeedVertexCount -= (*iter).count;
 				mDrawItems.erase(iter);
 				mOutOfDate = true;
 
@@ -129,7 +245,7 @@ namespace MyGUI
 #if MYGUI_DEBUG_MODE == 1
 		for (VectorDrawItem::iterator iter = mDrawItems.begin(); iter != mDrawItems.end(); ++iter)
 		{
-			MYGUI_ASSERT((*iter).first != _item, "DrawItem exist");
+			MYGUI_ASSERT((*iter).item != _item, "DrawItem exist");
 		}
 #endif
 
@@ -144,14 +260,14 @@ namespace MyGUI
 	{
 		for (VectorDrawItem::iterator iter = mDrawItems.begin(); iter != mDrawItems.end(); ++iter)
 		{
-			if ((*iter).first == _item)
+			if ((*iter).item == _item)
 			{
 				// если нужно меньше, то ниче не делаем
-				if ((*iter).second < _count)
+				if ((*iter).count < _count)
 				{
-					mNeedVertexCount -= (*iter).second;
+					mNeedVertexCount -= (*iter).count;
 					mNeedVertexCount += _count;
-					(*iter).second = _count;
+					(*iter).count = _count;
 					mOutOfDate = true;
 
 					mVertexBuffer->setVertexCount(mNeedVertexCount);
@@ -207,9 +323,31 @@ namespace MyGUI
 		mOutOfDate = true;
 	}
 
+	void RenderItem::outOfDate(ISubWidget* _item)
+	{
+		// whole buffer is going to be updated anyway
+		if (mOutOfDate)
+			return;
+
+		for (VectorDrawItem::iterator iter = mDrawItems.begin(); iter != mDrawItems.end(); ++iter)
+		{
+			if ((*iter).item == _item)
+			{
+				if (!(*iter).outOfDate)
+				{
+					(*iter).outOfDate = true;
+					++mOutOfDateDrawItems;
+				}
+				return;
+			}
+		}
+
+		mOutOfDate = true;
+	}
+
 	bool RenderItem::isOutOfDate() const
 	{
-		return mOutOfDate;
+		return mOutOfDate || mOutOfDateDrawItems != 0;
 	}
 
 	size_t RenderItem::getNeedVertexCount() const
@@ -15,11 +15,25 @@ namespace MyGUI
 	template <> RenderManager* Singleton<RenderManager>::msInstance = nullptr;
 	template <> const char* Singleton<RenderManager>::mClassTypeName = "RenderManager";
 
+	RenderManager::RenderManager() :
+		mFrameNumber(0),
+		mLastBatchTexture(nullptr),
+		mFrameTiming(false),
+		mTextureAtlasing(false),
+		mFullUpdate(false)
+	{
+	}
+
 	bool RenderManager::isFormatSupported(PixelFormat _format, TextureUsage _usage)
 	{
 		return true;
 	}
 
+	bool RenderManager::isShaderSupported(const std::string& _shaderName)
+	{
+		return false;
+	}
+
 #if MYGUI_DEBUG_MODE == 1
 	bool RenderManager::checkTexture(ITexture* _texture)
 	{
@@ -36,16 +50,104 @@ namespace MyGUI
 
 	void RenderManager::onRenderToTarget(IRenderTarget* _target, bool _update)
 	{
+		// textures packed during frame are uploaded once
+		mTextureAtlas.commit();
+
 		LayerManager* layers = LayerManager::getInstancePtr();
 		if (layers != nullptr)
-			layers->renderToTarget(_target, _update);
+		{
+			// request made during rendering is applied on next frame
+			bool update = _update || mFullUpdate;
+			mFullUpdate = false;
+			layers->renderToTarget(_target, update);
+		}
+	}
+
+	size_t RenderManager::getVertexBufferReallocations() const
+	{
+		return mLastStatistics.vertexBufferReallocations;
+	}
+
+	void RenderManager::_notifyVertexBufferReallocated()
+	{
+		++mStatistics.vertexBufferReallocations;
+	}
+
+	const FrameStatistics& RenderManager::getFrameStatistics() const
+	{
+		return mLastStatistics;
+	}
+
+	FrameStatistics& RenderManager::_getFrameStatistics()
+	{
+		return mStatistics;
+	}
+
+	void RenderManager::setFrameTiming(bool _value)
+	{
+		mFrameTiming = _value;
+	}
+
+	bool RenderManager::getFrameTiming() const
+	{
+		return mFrameTiming;
+	}
+
+	void RenderManager::_notifyBatchRendered(ITexture* _texture)
+	{
+		++mStatistics.drawCalls;
+		if (_texture != mLastBatchTexture)
+		{
+			++mStatistics.textureBinds;
+			mLastBatchTexture = _texture;
+		}
+	}
+
+	size_t RenderManager::_getFrameNumber() const
+	{
+		return mFrameNumber;
+	}
+
+	void RenderManager::setTextureAtlasing(bool _value)
+	{
+		mTextureAtlasing = _value;
+	}
+
+	bool RenderManager::getTextureAtlasing() const
+	{
+		return mTextureAtlasing;
+	}
+
+	bool RenderManager::_getTextureAtlasPlacement(const std::string& _texture, std::string& _page, IntPoint& _offset)
+	{
+		if (!mTextureAtlasing)
+			return false;
+		return mTextureAtlas.getPlacement(_texture, _page, _offset);
+	}
+
+	void RenderManager::_clearTextureAtlas()
+	{
+		mTextureAtlas.clear();
+	}
+
+	void RenderManager::_requestFullUpdate()
+	{
+		mFullUpdate = true;
 	}
 
 	void RenderManager::onFrameEvent(float _time)
 	{
+		++mFrameNumber;
+		mLastStatistics = mStatistics;
+		mStatistics.clear();
+		mLastBatchTexture = nullptr;
+
 		Gui* gui = Gui::getInstancePtr();
 		if (gui != nullptr)
+		{
+			FrameTimingScope timing(&FrameStatistics::frameEventTime);
 			gui->frameEvent(_time);
+		}
 	}
 
 } // namespace MyGUI
@@ -9,6 +9,7 @@
 #include "MyGUI_ResourceManager.h"
 #include "MyGUI_LanguageManager.h"
 #include "MyGUI_Constants.h"
+#include "MyGUI_RenderManager.h"
 
 namespace MyGUI
 {
@@ -43,6 +44,12 @@ namespace MyGUI
 
 			group.size = IntSize::parse(group_node->findAttribute("size"));
 
+			// frames of atlased texture are moved to it's place on atlas page
+			IntPoint offset;
+			std::string page;
+			if (RenderManager::getInstance()._getTextureAtlasPlacement(group.texture, page, offset))
+				group.texture = page;
+
 			xml::ElementEnumerator index_node = group_node->getElementEnumerator();
 			while (index_node.next("Index"))
 			{
@@ -58,7 +65,7 @@ namespace MyGUI
 					if ((count < 1) || (count > 256)) count = 1;
 					while (count > 0)
 					{
-						index.frames.push_back(point);
+						index.frames.push_back(point + offset);
 						-- count;
 					}
 				}
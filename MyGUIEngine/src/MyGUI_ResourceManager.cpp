@@ -6,12 +6,14 @@
 
 #include "MyGUI_Precompiled.h"
 #include "MyGUI_ResourceManager.h"
+#include "MyGUI_Profiler.h"
 #include "MyGUI_XmlDocument.h"
 #include "MyGUI_IResource.h"
 #include "MyGUI_DataManager.h"
 #include "MyGUI_FactoryManager.h"
 #include "MyGUI_DataStreamHolder.h"
 #include "MyGUI_ResourceImageSet.h"
+#include "MyGUI_RenderManager.h"
 
 namespace MyGUI
 {
@@ -49,6 +51,7 @@ namespace MyGUI
 		FactoryManager::getInstance().unregisterFactory<ResourceImageSet>(mCategoryName);
 
 		clear();
+		RenderManager::getInstance()._clearTextureAtlas();
 		unregisterLoadXmlDelegate(mCategoryName);
 		unregisterLoadXmlDelegate(mXmlListTagName);
 
@@ -63,6 +66,31 @@ namespace MyGUI
 		return _loadImplement(_file, false, "", getClassTypeName());
 	}
 
+	bool ResourceManager::compile(const std::string& _file, const std::string& _destination)
+	{
+		DataStreamHolder data = DataManager::getInstance().getData(_file);
+		if (data.getData() == nullptr)
+		{
+			MYGUI_LOG(Error, getClassTypeName() << " : '" << _file << "', not found");
+			return false;
+		}
+
+		xml::Document doc;
+		if (!doc.open(data.getData()))
+		{
+			MYGUI_LOG(Error, getClassTypeName() << " : '" << _file << "', " << doc.getLastError());
+			return false;
+		}
+
+		if (!doc.saveBinary(_destination))
+		{
+			MYGUI_LOG(Error, getClassTypeName() << " : '" << _file << "', " << doc.getLastError());
+			return false;
+		}
+
+		return true;
+	}
+
 	void ResourceManager::loadFromXmlNode(xml::ElementPtr _node, const std::string& _file, Version _version)
 	{
 		FactoryManager& factory = FactoryManager::getInstance();
@@ -131,6 +159,7 @@ namespace MyGUI
 
 	bool ResourceManager::_loadImplement(const std::string& _file, bool _match, const std::string& _type, const std::string& _instance)
 	{
+		MYGUI_PROFILE_ZONE("ResourceManager::_loadImplement");
 		DataStreamHolder data = DataManager::getInstance().getData(_file);
 		if (data.getData() == nullptr)
 		{
@@ -138,7 +167,9 @@ namespace MyGUI
 			return false;
 		}
 
+		// документ только читается и живет до конца загрузки
 		xml::Document doc;
+		doc.setArenaAllocation(true);
 		if (!doc.open(data.getData()))
 		{
 			MYGUI_LOG(Error, _instance << " : '" << _file << "', " << doc.getLastError());
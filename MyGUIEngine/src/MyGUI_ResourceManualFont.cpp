@@ -8,6 +8,7 @@
 #include "MyGUI_ResourceManualFont.h"
 #include "MyGUI_SkinManager.h"
 #include "MyGUI_RenderManager.h"
+#include "MyGUI_FontManager.h"
 #include "MyGUI_TextureUtility.h"
 
 namespace MyGUI
@@ -22,14 +23,18 @@ namespace MyGUI
 
 	ResourceManualFont::~ResourceManualFont()
 	{
+		// cached text layouts refer to glyphs of this font
+		FontManager* manager = FontManager::getInstancePtr();
+		if (manager != nullptr)
+			manager->getTextLayoutCache().removeFont(this);
 	}
 
 	GlyphInfo* ResourceManualFont::getGlyphInfo(Char _id)
 	{
-		CharMap::iterator iter = mCharMap.find(_id);
+		GlyphInfo* info = mGlyphTable.find(_id);
 
-		if (iter != mCharMap.end())
-			return &iter->second;
+		if (info != nullptr)
+			return info;
 
 		return mSubstituteGlyphInfo;
 	}
@@ -113,7 +118,7 @@ namespace MyGUI
 							if (advance == 0.0f)
 								advance = size.width;
 
-							GlyphInfo& glyphInfo = mCharMap.insert(CharMap::value_type(id, GlyphInfo(
+							GlyphInfo& glyphInfo = insertGlyphInfo(id, GlyphInfo(
 								id,
 								size.width,
 								size.height,
@@ -125,7 +130,7 @@ namespace MyGUI
 									coord.top / textureHeight,
 									coord.right() / textureWidth,
 									coord.bottom() / textureHeight)
-								))).first->second;
+								));
 
 							if (id == FontCodeType::NotDefined)
 								mSubstituteGlyphInfo = &glyphInfo;
@@ -166,10 +171,20 @@ namespace MyGUI
 
 	void ResourceManualFont::addGlyphInfo(Char id, const GlyphInfo& info)
 	{
-		GlyphInfo& inserted = mCharMap.insert(CharMap::value_type(id, info)).first->second;
+		GlyphInfo& inserted = insertGlyphInfo(id, info);
 
 		if (id == FontCodeType::NotDefined)
 			mSubstituteGlyphInfo = &inserted;
 	}
 
+	GlyphInfo& ResourceManualFont::insertGlyphInfo(Char _id, const GlyphInfo& _info)
+	{
+		std::pair<CharMap::iterator, bool> result = mCharMap.insert(CharMap::value_type(_id, _info));
+
+		if (result.second)
+			mGlyphTable.insert(_id, &result.first->second);
+
+		return result.first->second;
+	}
+
 } // namespace MyGUI
@@ -9,6 +9,7 @@
 #include "MyGUI_FactoryManager.h"
 #include "MyGUI_LanguageManager.h"
 #include "MyGUI_SubWidgetManager.h"
+#include "MyGUI_RenderManager.h"
 
 namespace MyGUI
 {
@@ -195,6 +196,12 @@ namespace MyGUI
 	{
 		mSize = _size;
 		mTexture = _texture;
+
+		// state coordinates are remapped by texture_utility::getTextureRect
+		std::string page;
+		IntPoint offset;
+		if (RenderManager::getInstance()._getTextureAtlasPlacement(_texture, page, offset))
+			mTexture = page;
 	}
 
 	void ResourceSkin::addInfo(const SubWidgetBinding& _bind)
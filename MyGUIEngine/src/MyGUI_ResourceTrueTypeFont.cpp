@@ -9,7 +9,9 @@
 #include "MyGUI_DataManager.h"
 #include "MyGUI_DataStreamHolder.h"
 #include "MyGUI_RenderManager.h"
+#include "MyGUI_FontManager.h"
 #include "MyGUI_Bitwise.h"
+#include <fstream>
 
 #ifdef MYGUI_USE_FREETYPE
 
@@ -18,6 +20,10 @@
 #	include FT_BITMAP_H
 #	include FT_WINFONTS_H
 
+#	ifndef MYGUI_NO_CXX11
+#		include <thread>
+#	endif
+
 #endif // MYGUI_USE_FREETYPE
 
 namespace MyGUI
@@ -30,6 +36,10 @@ namespace MyGUI
 
 	ResourceTrueTypeFont::~ResourceTrueTypeFont()
 	{
+		// cached text layouts refer to glyphs of this font
+		FontManager* manager = FontManager::getInstancePtr();
+		if (manager != nullptr)
+			manager->getTextLayoutCache().removeFont(this);
 	}
 
 	void ResourceTrueTypeFont::deserialization(xml::ElementPtr _node, Version _version)
@@ -107,10 +117,57 @@ namespace MyGUI
 	{
 	}
 
+	void ResourceTrueTypeFont::setLazy(bool _value)
+	{
+	}
+
+	void ResourceTrueTypeFont::setLazyTextureSize(int _value)
+	{
+	}
+
+	void ResourceTrueTypeFont::setLazyPageCount(int _value)
+	{
+	}
+
+	void ResourceTrueTypeFont::setDistanceField(bool _value)
+	{
+	}
+
+	void ResourceTrueTypeFont::setDistanceFieldSpread(int _value)
+	{
+	}
+
+	void ResourceTrueTypeFont::setCache(const std::string& _value)
+	{
+	}
+
+	bool ResourceTrueTypeFont::saveCache(const std::string& _fileName)
+	{
+		return false;
+	}
+
+	bool ResourceTrueTypeFont::hasKerning()
+	{
+		return false;
+	}
+
+	float ResourceTrueTypeFont::getKerning(Char _left, Char _right)
+	{
+		return 0.0f;
+	}
+
+	void ResourceTrueTypeFont::setKerning(bool _value)
+	{
+	}
+
 	void ResourceTrueTypeFont::addCodePointRange(Char _first, Char _second)
 	{
 	}
 
+	void ResourceTrueTypeFont::setRenderThreadCount(size_t _value)
+	{
+	}
+
 	void ResourceTrueTypeFont::removeCodePointRange(Char _first, Char _second)
 	{
 	}
@@ -134,6 +191,27 @@ namespace MyGUI
 			std::make_pair(FontCodeType::Tab, (const uint8)'\x00')
 		};
 
+		// Number of threads that render glyphs of fonts that are not lazy; zero for one per hardware thread.
+		size_t renderThreadCount = 0;
+
+		// Font cache files start with the signature and the version of the format; files of other versions are ignored.
+		const char fontCacheSignature[] = "MyGUIFontCache";
+		const uint32 fontCacheVersion = 1;
+
+		// Appends the bytes of _value to _data. Font cache files use the native byte order, so files saved on a machine with a
+		// different byte order don't match the version and are ignored.
+		template<typename T>
+		void writeCacheValue(std::string& _data, const T& _value)
+		{
+			_data.append(reinterpret_cast<const char*>(&_value), sizeof(T));
+		}
+
+		template<typename T>
+		bool readCacheValue(IDataStream* _stream, T& _value)
+		{
+			return _stream->read(&_value, sizeof(T)) == sizeof(T);
+		}
+
 		const std::map<const Char, const uint8> charMask(charMaskData, charMaskData + sizeof charMaskData / sizeof(*charMaskData));
 
 		const uint8 charMaskBlack = (const uint8)'\x00';
@@ -240,6 +318,114 @@ namespace MyGUI
 			}
 		};
 
+		// Computes the squared Euclidean distance transform of _count values located _stride apart, in place, using the algorithm
+		// by Felzenszwalb and Huttenlocher. The other arguments are work buffers of at least _count + 1 elements.
+		void distanceTransform(double* _data, size_t _stride, int _count, double* _values, int* _parabolas, double* _bounds)
+		{
+			const double infinity = std::numeric_limits<double>::infinity();
+
+			for (int q = 0; q < _count; ++q)
+				_values[q] = _data[q * _stride];
+
+			// Find the lower envelope of the parabolas rooted at every value.
+			int k = 0;
+			_parabolas[0] = 0;
+			_bounds[0] = -infinity;
+			_bounds[1] = infinity;
+
+			for (int q = 1; q < _count; ++q)
+			{
+				double s;
+				for (;;)
+				{
+					int v = _parabolas[k];
+					s = ((_values[q] + q * q) - (_values[v] + v * v)) / (2 * q - 2 * v);
+					if (s > _bounds[k])
+						break;
+					--k;
+				}
+
+				++k;
+				_parabolas[k] = q;
+				_bounds[k] = s;
+				_bounds[k + 1] = infinity;
+			}
+
+			// Sample the lower envelope.
+			k = 0;
+			for (int q = 0; q < _count; ++q)
+			{
+				while (_bounds[k + 1] < q)
+					++k;
+
+				int v = _parabolas[k];
+				_data[q * _stride] = (q - v) * (q - v) + _values[v];
+			}
+		}
+
+		// Computes the squared Euclidean distance transform of a _width x _height grid, in place.
+		void distanceTransform(std::vector<double>& _grid, int _width, int _height)
+		{
+			size_t count = (std::max)(_width, _height) + 1;
+			std::vector<double> values(count);
+			std::vector<int> parabolas(count);
+			std::vector<double> bounds(count + 1);
+
+			for (int x = 0; x < _width; ++x)
+				distanceTransform(&_grid[x], _width, _height, &values[0], &parabolas[0], &bounds[0]);
+
+			for (int y = 0; y < _height; ++y)
+				distanceTransform(&_grid[y * _width], 1, _width, &values[0], &parabolas[0], &bounds[0]);
+		}
+
+		// Converts an 8-bit coverage bitmap into a signed distance field of _width x _height with the bitmap placed _spread pixels
+		// from its top left corner. The glyph outline maps to 0x80; values decrease outward and increase inward, reaching 0x00 and
+		// 0xFF at _spread pixels from the outline.
+		void buildDistanceField(const uint8* _coverage, int _coverageWidth, int _coverageHeight, int _spread, uint8* _result, int _width, int _height)
+		{
+			const double infinity = 1e20;
+
+			size_t size = _width * _height;
+			std::vector<float> coverage(size, 0.0f);
+			std::vector<double> toInside(size); // Squared distance to the nearest pixel inside of the outline.
+			std::vector<double> toOutside(size); // Squared distance to the nearest pixel outside of the outline.
+
+			for (int y = 0; y < _coverageHeight && y + _spread < _height; ++y)
+			{
+				for (int x = 0; x < _coverageWidth && x + _spread < _width; ++x)
+					coverage[(y + _spread) * _width + x + _spread] = _coverage[y * _coverageWidth + x] / 255.0f;
+			}
+
+			for (size_t index = 0; index < size; ++index)
+			{
+				bool inside = coverage[index] >= 0.5f;
+				toInside[index] = inside ? 0.0 : infinity;
+				toOutside[index] = inside ? infinity : 0.0;
+			}
+
+			distanceTransform(toInside, _width, _height);
+			distanceTransform(toOutside, _width, _height);
+
+			for (size_t index = 0; index < size; ++index)
+			{
+				float value = coverage[index];
+
+				// The outline passes halfway between the centres of the nearest inside and outside pixels, except for pixels that
+				// the outline crosses, whose coverage tells how far the outline is from their centre.
+				float distance;
+				if (value > 0.0f && value < 1.0f)
+					distance = value - 0.5f;
+				else if (value >= 0.5f)
+					distance = (float)sqrt(toOutside[index]) - 0.5f;
+				else
+					distance = 0.5f - (float)sqrt(toInside[index]);
+
+				float alpha = 0.5f + distance / (2.0f * _spread);
+				alpha = (std::min)((std::max)(alpha, 0.0f), 1.0f);
+				_result[index] = (uint8)(alpha * 255.0f + 0.5f);
+			}
+		}
+
 	}
 
 	const int ResourceTrueTypeFont::mDefaultGlyphSpacing = 1;
@@ -247,6 +433,15 @@ namespace MyGUI
 	const float ResourceTrueTypeFont::mSelectedWidth = 1.0f;
 	const float ResourceTrueTypeFont::mCursorWidth = 2.0f;
 
+	// Default size of the glyph cache texture in lazy mode, in pixels.
+	const int LAZY_DEFAULT_TEXTURE_SIZE = 1024;
+	// Default number of pages of the glyph cache texture in lazy mode.
+	const int LAZY_DEFAULT_PAGE_COUNT = 4;
+	// Default distance field spread, in pixels.
+	const int DISTANCE_FIELD_DEFAULT_SPREAD = 4;
+	// Minimum number of glyphs rendered by one thread; fewer glyphs aren't worth loading another font face.
+	const size_t GLYPH_RENDER_JOBS_PER_THREAD = 64;
+
 	ResourceTrueTypeFont::ResourceTrueTypeFont() :
 		mSize(0),
 		mResolution(96),
@@ -257,14 +452,37 @@ namespace MyGUI
 		mTabWidth(0.0f),
 		mOffsetHeight(0),
 		mSubstituteCodePoint(static_cast<Char>(FontCodeType::NotDefined)),
+		mLazy(false),
+		mLazyTextureSize(LAZY_DEFAULT_TEXTURE_SIZE),
+		mLazyPageCount(LAZY_DEFAULT_PAGE_COUNT),
+		mDistanceField(false),
+		mDistanceFieldSpread(DISTANCE_FIELD_DEFAULT_SPREAD),
+		mKerning(false),
 		mDefaultHeight(0),
 		mSubstituteGlyphInfo(nullptr),
-		mTexture(nullptr)
+		mTexture(nullptr),
+		mUseDistanceField(false),
+		mCacheLoaded(false),
+		mFtLibrary(nullptr),
+		mFtFace(nullptr),
+		mFontBuffer(nullptr),
+		mFtLoadFlags(FT_LOAD_DEFAULT),
+		mFontAscent(0),
+		mLAMode(false),
+		mLazyCacheFull(false),
+		mPageHeight(0)
 	{
 	}
 
 	ResourceTrueTypeFont::~ResourceTrueTypeFont()
 	{
+		// cached text layouts refer to glyphs of this font
+		FontManager* manager = FontManager::getInstancePtr();
+		if (manager != nullptr)
+			manager->getTextLayoutCache().removeFont(this);
+
+		shutdownLazy();
+
 		if (mTexture != nullptr)
 		{
 			RenderManager::getInstance().destroyTexture(mTexture);
@@ -301,6 +519,20 @@ namespace MyGUI
 					setDistance(utility::parseInt(value));
 				else if (key == "Hinting")
 					setHinting(value);
+				else if (key == "Lazy")
+					setLazy(utility::parseBool(value));
+				else if (key == "LazyTextureSize")
+					setLazyTextureSize(utility::parseInt(value));
+				else if (key == "LazyPageCount")
+					setLazyPageCount(utility::parseInt(value));
+				else if (key == "DistanceField")
+					setDistanceField(utility::parseBool(value));
+				else if (key == "DistanceFieldSpread")
+					setDistanceFieldSpread(utility::parseInt(value));
+				else if (key == "Cache")
+					setCache(value);
+				else if (key == "Kerning")
+					setKerning(utility::parseBool(value));
 				else if (key == "SpaceWidth")
 				{
 					mSpaceWidth = utility::parseFloat(value);
@@ -359,11 +591,21 @@ namespace MyGUI
 
 	GlyphInfo* ResourceTrueTypeFont::getGlyphInfo(Char _id)
 	{
-		GlyphMap::iterator glyphIter = mGlyphMap.find(_id);
+		GlyphInfo* info = mGlyphTable.find(_id);
+
+		if (info != nullptr)
+		{
+			if (!mPages.empty())
+				mPages[getLazyPage(*info)].lastUsed = RenderManager::getInstance()._getFrameNumber();
+
+			return info;
+		}
 
-		if (glyphIter != mGlyphMap.end())
+		if (!mPages.empty())
 		{
-			return &glyphIter->second;
+			info = createLazyGlyph(_id);
+			if (info != nullptr)
+				return info;
 		}
 
 		return mSubstituteGlyphInfo;
@@ -374,6 +616,31 @@ namespace MyGUI
 		return mTexture;
 	}
 
+	bool ResourceTrueTypeFont::hasKerning()
+	{
+		return mKerning && mFtFace != nullptr && FT_HAS_KERNING(mFtFace);
+	}
+
+	float ResourceTrueTypeFont::getKerning(Char _left, Char _right)
+	{
+		if (!hasKerning())
+			return 0.0f;
+
+		std::pair<KerningMap::iterator, bool> result = mKerningCache.insert(KerningMap::value_type(std::make_pair(_left, _right), 0.0f));
+
+		if (result.second)
+		{
+			// Distance field glyphs are scaled, so their kerning isn't rounded to whole pixels.
+			FT_UInt kerningMode = mUseDistanceField ? FT_KERNING_UNFITTED : FT_KERNING_DEFAULT;
+			FT_Vector kerning;
+
+			if (FT_Get_Kerning(mFtFace, FT_Get_Char_Index(mFtFace, _left), FT_Get_Char_Index(mFtFace, _right), kerningMode, &kerning) == 0)
+				result.first->second = kerning.x / 64.0f;
+		}
+
+		return result.first->second;
+	}
+
 	int ResourceTrueTypeFont::getDefaultHeight()
 	{
 		return mDefaultHeight;
@@ -382,7 +649,21 @@ namespace MyGUI
 	void ResourceTrueTypeFont::textureInvalidate(ITexture* _texture)
 	{
 		mGlyphMap.clear();
+		mGlyphTable.clear();
+
+		// Initialisation adjusts the code points to the font face, so the cache key would no longer match; load the cache again
+		// with the key of the first initialisation instead.
+		if (mCacheLoaded && loadCache())
+			return;
+
 		initialise();
+
+		// Glyphs are rendered again in a different order, so their texture coordinates change.
+		if (mLazy)
+		{
+			FontManager::getInstance().getTextLayoutCache().removeFont(this);
+			RenderManager::getInstance()._requestFullUpdate();
+		}
 	}
 
 	std::vector<std::pair<Char, Char> > ResourceTrueTypeFont::getCodePointRanges() const
@@ -459,11 +740,55 @@ namespace MyGUI
 
 	void ResourceTrueTypeFont::initialise()
 	{
+		shutdownLazy();
+
 		if (mGlyphSpacing == -1)
 			mGlyphSpacing = mDefaultGlyphSpacing;
 
-		// If L8A8 (2 bytes per pixel) is supported, use it; otherwise, use R8G8B8A8 (4 bytes per pixel) as L8L8L8A8.
-		bool laMode = MyGUI::RenderManager::getInstance().isFormatSupported(Pixel<true>::getFormat(), TextureUsage::Static | TextureUsage::Write);
+		mUseDistanceField = mDistanceField && RenderManager::getInstance().isShaderSupported("DistanceField");
+
+		if (mDistanceField && !mUseDistanceField)
+			MYGUI_LOG(Warning, "ResourceTrueTypeFont: Render system doesn't support distance field shader; font '" << getResourceName() << "' is rendered as usual.");
+
+		// If L8A8 (2 bytes per pixel) is supported, use it; otherwise, use R8G8B8A8 (4 bytes per pixel) as L8L8L8A8. Distance field
+		// glyphs are always R8G8B8A8, because their pixels are told from the pixels of the special glyphs by color.
+		bool laMode = !mUseDistanceField && MyGUI::RenderManager::getInstance().isFormatSupported(Pixel<true>::getFormat(), TextureUsage::Static | TextureUsage::Write);
+
+		// Load the font from the cache file if possible. The key is kept to save the cache after the font has been rendered.
+		mCacheKey = mLazy ? std::string() : getCacheKey(laMode);
+		mCacheLoaded = !mCache.empty() && !mLazy && loadCache();
+
+		if (mCacheLoaded)
+		{
+			MYGUI_LOG(Info, "ResourceTrueTypeFont: Font '" << getResourceName() << "' loaded from cache '" << mCache << "'.");
+
+			// The cache has no kerning, so load the font face to look it up.
+			if (mKerning)
+			{
+				FT_Library ftLibrary;
+
+				if (FT_Init_FreeType(&ftLibrary) != 0)
+					MYGUI_EXCEPT("ResourceTrueTypeFont: Could not init the FreeType library!");
+
+				uint8* fontBuffer = nullptr;
+				FT_Face ftFace = loadFace(ftLibrary, fontBuffer);
+
+				if (ftFace != nullptr)
+				{
+					keepFaceForKerning(ftLibrary, ftFace, fontBuffer);
+				}
+				else
+				{
+					FT_Done_FreeType(ftLibrary);
+					delete [] fontBuffer;
+				}
+			}
+
+			return;
+		}
+
+		if (!mCache.empty() && !mLazy)
+			MYGUI_LOG(Warning, "ResourceTrueTypeFont: Cache '" << mCache << "' of font '" << getResourceName() << "' is missing or out of date; font is rendered with FreeType.");
 
 		// Select and call an appropriate initialisation method. By making this decision up front, we avoid having to branch on
 		// these variables many thousands of times inside tight nested loops later. From this point on, the various function
@@ -559,6 +884,12 @@ namespace MyGUI
 			break;
 		}
 
+		if (mLazy)
+		{
+			initialiseLazy<LAMode, Antialias>(ftLibrary, ftFace, fontBuffer, fontAscent, ftLoadFlags);
+			return;
+		}
+
 		//-------------------------------------------------------------------//
 		// Create the glyphs and calculate their metrics.
 		//-------------------------------------------------------------------//
@@ -703,6 +1034,9 @@ namespace MyGUI
 		mTexture->createManual(texWidth, texHeight, TextureUsage::Static | TextureUsage::Write, Pixel<LAMode>::getFormat());
 		mTexture->setInvalidateListener(this);
 
+		if (mUseDistanceField)
+			mTexture->setShader("DistanceField");
+
 		uint8* texBuffer = static_cast<uint8*>(mTexture->lock(TextureUsage::Write));
 
 		if (texBuffer != nullptr)
@@ -723,10 +1057,224 @@ namespace MyGUI
 			MYGUI_LOG(Error, "ResourceTrueTypeFont: Error locking texture; pointer is nullptr.");
 		}
 
-		FT_Done_Face(ftFace);
-		FT_Done_FreeType(ftLibrary);
+		keepFaceForKerning(ftLibrary, ftFace, fontBuffer);
+	}
+
+	void ResourceTrueTypeFont::keepFaceForKerning(const FT_Library& _ftLibrary, const FT_Face& _ftFace, uint8* _fontBuffer)
+	{
+		if (mKerning && FT_HAS_KERNING(_ftFace))
+		{
+			// The face is released by shutdownLazy().
+			mFtLibrary = _ftLibrary;
+			mFtFace = _ftFace;
+			mFontBuffer = _fontBuffer;
+			return;
+		}
+
+		FT_Done_Face(_ftFace);
+		FT_Done_FreeType(_ftLibrary);
+
+		delete [] _fontBuffer;
+	}
+
+	std::string ResourceTrueTypeFont::getCacheKey(bool _laMode) const
+	{
+		std::string result;
+
+		writeCacheValue(result, mSize);
+		writeCacheValue(result, mResolution);
+		writeCacheValue(result, (int)mHinting);
+		writeCacheValue(result, mAntialias);
+		writeCacheValue(result, mSpaceWidth);
+		writeCacheValue(result, mGlyphSpacing);
+		writeCacheValue(result, mTabWidth);
+		writeCacheValue(result, mOffsetHeight);
+		writeCacheValue(result, mSubstituteCodePoint);
+		writeCacheValue(result, mUseDistanceField);
+		writeCacheValue(result, mUseDistanceField ? mDistanceFieldSpread : 0);
+		writeCacheValue(result, _laMode);
+
+		std::vector<std::pair<Char, Char> > ranges = getCodePointRanges();
+		writeCacheValue(result, (uint32)ranges.size());
+
+		for (std::vector<std::pair<Char, Char> >::const_iterator iter = ranges.begin(); iter != ranges.end(); ++iter)
+		{
+			writeCacheValue(result, iter->first);
+			writeCacheValue(result, iter->second);
+		}
+
+		return result;
+	}
+
+	bool ResourceTrueTypeFont::addSourceToCacheKey(std::string& _key) const
+	{
+		DataStreamHolder data(DataManager::getInstance().getData(mSource));
+		IDataStream* stream = data.getData();
+
+		if (stream == nullptr)
+			return false;
+
+		// 32-bit FNV-1a hash of the font file.
+		uint32 hash = 2166136261U;
+		uint8 buffer[4096];
+		size_t size = stream->size();
+
+		for (size_t left = size; left != 0; )
+		{
+			size_t count = stream->read(buffer, (std::min)(left, sizeof(buffer)));
+			if (count == 0)
+				return false;
+
+			for (size_t index = 0; index < count; ++index)
+			{
+				hash ^= buffer[index];
+				hash *= 16777619U;
+			}
+
+			left -= count;
+		}
+
+		writeCacheValue(_key, (uint32)size);
+		writeCacheValue(_key, hash);
+
+		return true;
+	}
+
+	bool ResourceTrueTypeFont::loadCache()
+	{
+		std::string key = mCacheKey;
+
+		if (!addSourceToCacheKey(key))
+			return false;
+
+		DataStreamHolder data(DataManager::getInstance().getData(mCache));
+		IDataStream* stream = data.getData();
+
+		if (stream == nullptr)
+			return false;
+
+		//-------------------------------------------------------------------//
+		// Check that the cache was saved for the same font.
+		//-------------------------------------------------------------------//
+
+		std::string fileSignature(sizeof(fontCacheSignature) - 1, '\0');
+		uint32 fileVersion = 0;
+		uint32 fileKeySize = 0;
+
+		if (stream->read(&fileSignature[0], fileSignature.size()) != fileSignature.size() || fileSignature != fontCacheSignature ||
+			!readCacheValue(stream, fileVersion) || fileVersion != fontCacheVersion ||
+			!readCacheValue(stream, fileKeySize) || fileKeySize != key.size())
+			return false;
+
+		std::string fileKey(key.size(), '\0');
+
+		if (stream->read(&fileKey[0], fileKey.size()) != fileKey.size() || fileKey != key)
+			return false;
+
+		//-------------------------------------------------------------------//
+		// Read the font metrics and glyphs.
+		//-------------------------------------------------------------------//
+
+		int defaultHeight = 0;
+		float tabWidth = 0.0f;
+		Char substituteCodePoint = 0;
+		int texWidth = 0;
+		int texHeight = 0;
+		bool laMode = false;
+		uint32 charCount = 0;
+		uint32 glyphCount = 0;
+
+		if (!readCacheValue(stream, defaultHeight) || !readCacheValue(stream, tabWidth) || !readCacheValue(stream, substituteCodePoint) ||
+			!readCacheValue(stream, texWidth) || !readCacheValue(stream, texHeight) || !readCacheValue(stream, laMode) ||
+			!readCacheValue(stream, charCount) || !readCacheValue(stream, glyphCount) || texWidth <= 0 || texHeight <= 0)
+			return false;
+
+		// Data streams don't always report reading past the end, so check that the file has exactly the size it should have.
+		size_t headerSize = fileSignature.size() + sizeof(uint32) * 2 + fileKey.size() +
+			sizeof(int) * 3 + sizeof(float) + sizeof(Char) + sizeof(bool) + sizeof(uint32) * 2;
+		size_t charSize = sizeof(Char) + sizeof(FT_UInt);
+		size_t glyphSize = sizeof(Char) + sizeof(float) * 9;
+		size_t texSize = texWidth * texHeight * (laMode ? Pixel<true>::getNumBytes() : Pixel<false>::getNumBytes());
+
+		if (stream->size() != headerSize + charCount * charSize + glyphCount * glyphSize + texSize)
+			return false;
+
+		CharMap charMap;
+
+		for (uint32 index = 0; index < charCount; ++index)
+		{
+			Char codePoint = 0;
+			FT_UInt glyphIndex = 0;
+
+			if (!readCacheValue(stream, codePoint) || !readCacheValue(stream, glyphIndex))
+				return false;
+
+			charMap.insert(charMap.end(), CharMap::value_type(codePoint, glyphIndex));
+		}
+
+		GlyphMap glyphMap;
+
+		for (uint32 index = 0; index < glyphCount; ++index)
+		{
+			GlyphInfo info;
+
+			if (!readCacheValue(stream, info.codePoint) || !readCacheValue(stream, info.width) || !readCacheValue(stream, info.height) ||
+				!readCacheValue(stream, info.advance) || !readCacheValue(stream, info.bearingX) || !readCacheValue(stream, info.bearingY) ||
+				!readCacheValue(stream, info.uvRect.left) || !readCacheValue(stream, info.uvRect.top) ||
+				!readCacheValue(stream, info.uvRect.right) || !readCacheValue(stream, info.uvRect.bottom))
+				return false;
 
-		delete [] fontBuffer;
+			glyphMap.insert(GlyphMap::value_type(info.codePoint, info));
+		}
+
+		if (glyphMap.find(substituteCodePoint) == glyphMap.end())
+			return false;
+
+		//-------------------------------------------------------------------//
+		// Create the texture and read the pixels right into it.
+		//-------------------------------------------------------------------//
+
+		if (mTexture)
+		{
+			RenderManager::getInstance().destroyTexture( mTexture );
+			mTexture = nullptr;
+		}
+
+		mTexture = RenderManager::getInstance().createTexture(MyGUI::utility::toString((size_t)this, "_TrueTypeFont"));
+
+		mTexture->createManual(texWidth, texHeight, TextureUsage::Static | TextureUsage::Write, laMode ? Pixel<true>::getFormat() : Pixel<false>::getFormat());
+		mTexture->setInvalidateListener(this);
+
+		if (mUseDistanceField)
+			mTexture->setShader("DistanceField");
+
+		uint8* texBuffer = static_cast<uint8*>(mTexture->lock(TextureUsage::Write));
+
+		if (texBuffer == nullptr)
+		{
+			MYGUI_LOG(Error, "ResourceTrueTypeFont: Error locking texture; pointer is nullptr.");
+			return false;
+		}
+
+		bool result = stream->read(texBuffer, texSize) == texSize;
+
+		mTexture->unlock();
+
+		if (!result)
+			return false;
+
+		mDefaultHeight = defaultHeight;
+		mTabWidth = tabWidth;
+		mSubstituteCodePoint = substituteCodePoint;
+		mCharMap.swap(charMap);
+		mGlyphMap.swap(glyphMap);
+		mSubstituteGlyphInfo = &mGlyphMap.find(mSubstituteCodePoint)->second;
+
+		mGlyphTable.clear();
+		for (GlyphMap::iterator iter = mGlyphMap.begin(); iter != mGlyphMap.end(); ++iter)
+			mGlyphTable.insert(iter->first, &iter->second);
+
+		return true;
 	}
 
 	FT_Face ResourceTrueTypeFont::loadFace(const FT_Library& _ftLibrary, uint8*& _fontBuffer)
@@ -854,13 +1402,38 @@ namespace MyGUI
 		// float ascent = _glyph->metrics.horiBearingY / 64.0f;
 		// float descent = (_glyph->metrics.height / 64.0f) - ascent;
 
-		return GlyphInfo(
+		GlyphInfo info(
 			_codePoint,
 			std::max((float)_glyph->bitmap.width, _glyph->metrics.width / 64.0f),
 			std::max((float)_glyph->bitmap.rows, _glyph->metrics.height / 64.0f),
 			(_glyph->advance.x / 64.0f) - bearingX,
 			bearingX,
 			floor(_fontAscent - (_glyph->metrics.horiBearingY / 64.0f) - mOffsetHeight));
+
+		// The distance field extends past the glyph outline, so the glyph grows by the spread on every side while the pen position
+		// after the glyph stays the same.
+		if (mUseDistanceField && info.width > 0.0f && info.height > 0.0f)
+		{
+			float spread = (float)mDistanceFieldSpread;
+
+			info.width += spread * 2.0f;
+			info.height += spread * 2.0f;
+			info.bearingX -= spread;
+			info.bearingY -= spread;
+			info.advance += spread;
+		}
+
+		return info;
+	}
+
+	GlyphInfo& ResourceTrueTypeFont::insertGlyphInfo(Char _codePoint, const GlyphInfo& _info)
+	{
+		std::pair<GlyphMap::iterator, bool> result = mGlyphMap.insert(GlyphMap::value_type(_codePoint, _info));
+
+		if (result.second)
+			mGlyphTable.insert(_codePoint, &result.first->second);
+
+		return result.first->second;
 	}
 
 	int ResourceTrueTypeFont::createGlyph(FT_UInt _glyphIndex, const GlyphInfo& _glyphInfo, GlyphHeightMap& _glyphHeightMap)
@@ -869,7 +1442,7 @@ namespace MyGUI
 		int height = (int)ceil(_glyphInfo.height);
 
 		mCharMap[_glyphInfo.codePoint] = _glyphIndex;
-		GlyphInfo& info = mGlyphMap.insert(GlyphMap::value_type(_glyphInfo.codePoint, _glyphInfo)).first->second;
+		GlyphInfo& info = insertGlyphInfo(_glyphInfo.codePoint, _glyphInfo);
 		_glyphHeightMap[(FT_Pos)height].insert(std::make_pair(_glyphIndex, &info));
 
 		return (width > 0) ? mGlyphSpacing + width : 0;
@@ -895,8 +1468,7 @@ namespace MyGUI
 	template<bool LAMode, bool Antialias>
 	void ResourceTrueTypeFont::renderGlyphs(const GlyphHeightMap& _glyphHeightMap, const FT_Library& _ftLibrary, const FT_Face& _ftFace, FT_Int32 _ftLoadFlags, uint8* _texBuffer, int _texWidth, int _texHeight)
 	{
-		FT_Bitmap ftBitmap;
-		FT_Bitmap_New(&ftBitmap);
+		VectorGlyphRenderJob jobs;
 
 		int texX = mGlyphSpacing, texY = mGlyphSpacing;
 
@@ -927,54 +1499,145 @@ namespace MyGUI
 					break;
 
 				default:
-					if (FT_Load_Glyph(_ftFace, i->first, _ftLoadFlags | FT_LOAD_RENDER) == 0)
-					{
-						if (_ftFace->glyph->bitmap.buffer != nullptr)
-						{
-							uint8* glyphBuffer = nullptr;
-
-							switch (_ftFace->glyph->bitmap.pixel_mode)
-							{
-							case FT_PIXEL_MODE_GRAY:
-								glyphBuffer = _ftFace->glyph->bitmap.buffer;
-								break;
-
-							case FT_PIXEL_MODE_MONO:
-								// Convert the monochrome bitmap to 8-bit before rendering it.
-								if (FT_Bitmap_Convert(_ftLibrary, &_ftFace->glyph->bitmap, &ftBitmap, 1) == 0)
-								{
-									// Go through the bitmap and convert all of the nonzero values to 0xFF (white).
-									for (uint8* p = ftBitmap.buffer, * endP = p + ftBitmap.width * ftBitmap.rows; p != endP; ++p)
-										*p ^= -*p ^ *p;
-
-									glyphBuffer = ftBitmap.buffer;
-								}
-								break;
-							}
-
-							if (glyphBuffer != nullptr)
-								renderGlyph<LAMode, true, Antialias>(info, charMaskWhite, charMaskWhite, charMaskWhite, j->first, _texBuffer, _texWidth, _texHeight, texX, texY, glyphBuffer);
-						}
-					}
-					else
-					{
-						MYGUI_LOG(Warning, "ResourceTrueTypeFont: Cannot render glyph " << i->first << " for character " << info.codePoint << " in font '" << getResourceName() << "'.");
-					}
-					break;
+				{
+					// Reserve the same texture position that renderGlyph() would use, so that the layout doesn't depend on the
+					// order in which the glyphs are rendered.
+					int width = (int)ceil(info.width);
+
+					autoWrapGlyphPos(width, _texWidth, j->first, texX, texY);
+
+					GlyphRenderJob job = { i->first, &info, texX, texY, (int)j->first, false, false };
+					jobs.push_back(job);
+
+					if (width > 0)
+						texX += mGlyphSpacing + width;
+				}
+				break;
 				}
 			}
 		}
 
-		FT_Bitmap_Done(_ftLibrary, &ftBitmap);
-	}
+#ifndef MYGUI_NO_CXX11
+		size_t threadCount = renderThreadCount != 0 ? renderThreadCount : (size_t)std::thread::hardware_concurrency();
+		threadCount = (std::max)((std::min)(threadCount, jobs.size() / GLYPH_RENDER_JOBS_PER_THREAD), (size_t)1);
 
-	template<bool LAMode, bool UseBuffer, bool Antialias>
-	void ResourceTrueTypeFont::renderGlyph(GlyphInfo& _info, uint8 _luminance0, uint8 _luminance1, uint8 _alpha, int _lineHeight, uint8* _texBuffer, int _texWidth, int _texHeight, int& _texX, int& _texY, uint8* _glyphBuffer)
-	{
-		int width = (int)ceil(_info.width);
-		int height = (int)ceil(_info.height);
+		// Every thread takes every threadCount-th job; the glyphs are sorted by height, so the threads get similar work.
+		std::vector<std::thread> workers;
+		std::vector<std::exception_ptr> errors(threadCount);
+		try
+		{
+			for (size_t index = 1; index < threadCount; ++index)
+				workers.push_back(std::thread(&ResourceTrueTypeFont::renderGlyphJobsWorker<LAMode, Antialias>, this, &jobs, index, threadCount, _ftFace, _ftLoadFlags, _texBuffer, _texWidth, _texHeight, &errors[index]));
 
-		autoWrapGlyphPos(width, _texWidth, _lineHeight, _texX, _texY);
+			renderGlyphJobs<LAMode, Antialias>(jobs, 0, threadCount, _ftLibrary, _ftFace, _ftLoadFlags, _texBuffer, _texWidth, _texHeight);
+		}
+		catch (...)
+		{
+			// Running threads can't be destroyed, and they still use the jobs and the texture buffer.
+			for (size_t index = 0; index < workers.size(); ++index)
+				workers[index].join();
+			throw;
+		}
+
+		for (size_t index = 0; index < workers.size(); ++index)
+			workers[index].join();
+
+		for (size_t index = 0; index < errors.size(); ++index)
+		{
+			if (errors[index])
+				std::rethrow_exception(errors[index]);
+		}
+#else
+		renderGlyphJobs<LAMode, Antialias>(jobs, 0, 1, _ftLibrary, _ftFace, _ftLoadFlags, _texBuffer, _texWidth, _texHeight);
+#endif
+
+		for (size_t index = 0; index < jobs.size(); ++index)
+		{
+			// A worker that couldn't load the font face leaves its jobs to the calling thread.
+			if (!jobs[index].done)
+				renderGlyphJobs<LAMode, Antialias>(jobs, index, jobs.size(), _ftLibrary, _ftFace, _ftLoadFlags, _texBuffer, _texWidth, _texHeight);
+
+			if (jobs[index].failed)
+				MYGUI_LOG(Warning, "ResourceTrueTypeFont: Cannot render glyph " << jobs[index].glyphIndex << " for character " << jobs[index].info->codePoint << " in font '" << getResourceName() << "'.");
+		}
+	}
+
+	template<bool LAMode, bool Antialias>
+	void ResourceTrueTypeFont::renderGlyphJobs(VectorGlyphRenderJob& _jobs, size_t _first, size_t _step, const FT_Library& _ftLibrary, const FT_Face& _ftFace, FT_Int32 _ftLoadFlags, uint8* _texBuffer, int _texWidth, int _texHeight)
+	{
+		FT_Bitmap ftBitmap;
+		FT_Bitmap_New(&ftBitmap);
+
+		for (size_t index = _first; index < _jobs.size(); index += _step)
+		{
+			GlyphRenderJob& job = _jobs[index];
+			job.done = true;
+
+			if (FT_Load_Glyph(_ftFace, job.glyphIndex, _ftLoadFlags | FT_LOAD_RENDER) == 0)
+			{
+				uint8* glyphBuffer = getGlyphBitmap(_ftLibrary, _ftFace, ftBitmap);
+
+				if (glyphBuffer != nullptr)
+				{
+					if (mUseDistanceField)
+						renderDistanceFieldGlyph(*job.info, job.lineHeight, _texBuffer, _texWidth, _texHeight, job.texX, job.texY, glyphBuffer, _ftFace->glyph->bitmap.width, _ftFace->glyph->bitmap.rows);
+					else
+						renderGlyph<LAMode, true, Antialias>(*job.info, charMaskWhite, charMaskWhite, charMaskWhite, job.lineHeight, _texBuffer, _texWidth, _texHeight, job.texX, job.texY, glyphBuffer);
+				}
+			}
+			else
+			{
+				job.failed = true;
+			}
+		}
+
+		FT_Bitmap_Done(_ftLibrary, &ftBitmap);
+	}
+
+#ifndef MYGUI_NO_CXX11
+	template<bool LAMode, bool Antialias>
+	void ResourceTrueTypeFont::renderGlyphJobsWorker(VectorGlyphRenderJob* _jobs, size_t _first, size_t _step, FT_Face _ftFace, FT_Int32 _ftLoadFlags, uint8* _texBuffer, int _texWidth, int _texHeight, std::exception_ptr* _error)
+	{
+		// FreeType objects can't be shared between threads, but the font file in memory can.
+		FT_Library ftLibrary;
+
+		if (FT_Init_FreeType(&ftLibrary) != 0)
+			return;
+
+		FT_Face ftFace = nullptr;
+
+		if (FT_New_Memory_Face(ftLibrary, _ftFace->stream->base, (FT_Long)_ftFace->stream->size, _ftFace->face_index, &ftFace) == 0)
+		{
+			// Select the same size as loadFace() did for the original face.
+			FT_Error error = (ftFace->face_flags & FT_FACE_FLAG_SCALABLE) ?
+				FT_Set_Char_Size(ftFace, (FT_F26Dot6)(mSize * (1 << 6)), 0, mResolution, mResolution) :
+				FT_Select_Size(ftFace, 0);
+
+			// An exception can't leave the thread, it would terminate the process.
+			try
+			{
+				if (error == 0)
+					renderGlyphJobs<LAMode, Antialias>(*_jobs, _first, _step, ftLibrary, ftFace, _ftLoadFlags, _texBuffer, _texWidth, _texHeight);
+			}
+			catch (...)
+			{
+				*_error = std::current_exception();
+			}
+
+			FT_Done_Face(ftFace);
+		}
+
+		FT_Done_FreeType(ftLibrary);
+	}
+#endif
+
+	template<bool LAMode, bool UseBuffer, bool Antialias>
+	void ResourceTrueTypeFont::renderGlyph(GlyphInfo& _info, uint8 _luminance0, uint8 _luminance1, uint8 _alpha, int _lineHeight, uint8* _texBuffer, int _texWidth, int _texHeight, int& _texX, int& _texY, uint8* _glyphBuffer)
+	{
+		int width = (int)ceil(_info.width);
+		int height = (int)ceil(_info.height);
+
+		autoWrapGlyphPos(width, _texWidth, _lineHeight, _texX, _texY);
 
 		uint8* dest = _texBuffer + (_texY * _texWidth + _texX) * Pixel<LAMode>::getNumBytes();
 
@@ -1006,6 +1669,463 @@ namespace MyGUI
 			_texX += mGlyphSpacing + width;
 	}
 
+	void ResourceTrueTypeFont::renderDistanceFieldGlyph(GlyphInfo& _info, int _lineHeight, uint8* _texBuffer, int _texWidth, int _texHeight, int& _texX, int& _texY, const uint8* _glyphBuffer, int _glyphWidth, int _glyphHeight)
+	{
+		int width = (int)ceil(_info.width);
+		int height = (int)ceil(_info.height);
+
+		autoWrapGlyphPos(width, _texWidth, _lineHeight, _texX, _texY);
+
+		std::vector<uint8> distanceField(width * height);
+
+		if (!distanceField.empty())
+			buildDistanceField(_glyphBuffer, _glyphWidth, _glyphHeight, mDistanceFieldSpread, &distanceField[0], width, height);
+
+		const uint8* source = distanceField.empty() ? nullptr : &distanceField[0];
+
+		for (int j = 0; j < height; ++j)
+		{
+			uint8* dest = _texBuffer + ((_texY + j) * _texWidth + _texX) * Pixel<false>::getNumBytes();
+
+			for (int i = width; i > 0; --i)
+			{
+				*dest++ = charMaskBlack;
+				*dest++ = charMaskWhite;
+				*dest++ = charMaskBlack;
+				*dest++ = *source++;
+			}
+		}
+
+		// Calculate and store the glyph's UV coordinates within the texture.
+		_info.uvRect.left = (float)_texX / _texWidth; // u1
+		_info.uvRect.top = (float)_texY / _texHeight; // v1
+		_info.uvRect.right = (float)(_texX + _info.width) / _texWidth; // u2
+		_info.uvRect.bottom = (float)(_texY + _info.height) / _texHeight; // v2
+
+		if (width > 0)
+			_texX += mGlyphSpacing + width;
+	}
+
+	uint8* ResourceTrueTypeFont::getGlyphBitmap(const FT_Library& _ftLibrary, const FT_Face& _ftFace, FT_Bitmap& _ftBitmap)
+	{
+		if (_ftFace->glyph->bitmap.buffer == nullptr)
+			return nullptr;
+
+		switch (_ftFace->glyph->bitmap.pixel_mode)
+		{
+		case FT_PIXEL_MODE_GRAY:
+			return _ftFace->glyph->bitmap.buffer;
+
+		case FT_PIXEL_MODE_MONO:
+			// Convert the monochrome bitmap to 8-bit before rendering it.
+			if (FT_Bitmap_Convert(_ftLibrary, &_ftFace->glyph->bitmap, &_ftBitmap, 1) == 0)
+			{
+				// Go through the bitmap and convert all of the nonzero values to 0xFF (white).
+				for (uint8* p = _ftBitmap.buffer, * endP = p + _ftBitmap.width * _ftBitmap.rows; p != endP; ++p)
+					*p ^= -*p ^ *p;
+
+				return _ftBitmap.buffer;
+			}
+			break;
+		}
+
+		return nullptr;
+	}
+
+	template<bool LAMode, bool Antialias>
+	void ResourceTrueTypeFont::initialiseLazy(const FT_Library& _ftLibrary, const FT_Face& _ftFace, uint8* _fontBuffer, int _fontAscent, FT_Int32 _ftLoadFlags)
+	{
+		// Keep the face loaded; it's released by shutdownLazy().
+		mFtLibrary = _ftLibrary;
+		mFtFace = _ftFace;
+		mFontBuffer = _fontBuffer;
+		mFtLoadFlags = _ftLoadFlags;
+		mFontAscent = _fontAscent;
+		mLAMode = LAMode;
+		mLazyCacheFull = false;
+
+		// Glyphs rendered by a previous initialisation are lost together with the texture.
+		mGlyphMap.clear();
+		mGlyphTable.clear();
+
+		//-------------------------------------------------------------------//
+		// Create the glyph cache texture and split it into pages.
+		//-------------------------------------------------------------------//
+
+		int texSize = Bitwise::firstPO2From((std::max)(mLazyTextureSize, 64));
+		int pageCount = (std::min)((std::max)(mLazyPageCount, 2), texSize / 16);
+		mPageHeight = texSize / pageCount;
+
+		mPages.resize(pageCount);
+		for (int index = 0; index < pageCount; ++index)
+		{
+			GlyphPage& page = mPages[index];
+			page.top = index * mPageHeight;
+			page.bottom = (index + 1 == pageCount) ? texSize : page.top + mPageHeight;
+			page.shelfLeft = 0;
+			page.shelfTop = page.top;
+			page.shelfHeight = 0;
+			page.lastUsed = 0;
+			page.cleared = false;
+		}
+
+		if (mTexture)
+		{
+			RenderManager::getInstance().destroyTexture( mTexture );
+			mTexture = nullptr;
+		}
+
+		mTexture = RenderManager::getInstance().createTexture(MyGUI::utility::toString((size_t)this, "_TrueTypeFont"));
+
+		mTexture->createManual(texSize, texSize, TextureUsage::Static | TextureUsage::Write, Pixel<LAMode>::getFormat());
+		mTexture->setInvalidateListener(this);
+
+		if (mUseDistanceField)
+			mTexture->setShader("DistanceField");
+
+		// Pages are allocated and made transparent white on first use, so that unused pages cost nothing.
+		mTextureData.clear();
+
+		//-------------------------------------------------------------------//
+		// Create the glyphs that are needed up front. All of them end up on the first page, which is never evicted.
+		//-------------------------------------------------------------------//
+
+		// The "Space" glyph is needed to calculate the width of the "Tab" glyph.
+		addCodePoint(FontCodeType::Space);
+
+		GlyphInfo* spaceGlyphInfo = createLazyGlyph(FontCodeType::Space);
+
+		if (spaceGlyphInfo != nullptr)
+		{
+			// Adjust the width of the "Space" glyph if it has been customized.
+			if (mSpaceWidth != 0.0f)
+			{
+				spaceGlyphInfo->width = mSpaceWidth;
+				spaceGlyphInfo->advance = mSpaceWidth;
+			}
+
+			// If the width of the "Tab" glyph hasn't been customized, make it eight spaces wide.
+			if (mTabWidth == 0.0f)
+				mTabWidth = mDefaultTabWidth * spaceGlyphInfo->advance;
+		}
+
+		FT_UInt nextGlyphIndex = (FT_UInt)mFtFace->num_glyphs;
+
+		float height = (float)mDefaultHeight;
+
+		createLazySpecialGlyph<LAMode>(nextGlyphIndex++, GlyphInfo(static_cast<Char>(FontCodeType::Tab), 0.0f, 0.0f, mTabWidth, 0.0f, 0.0f), charMask.find(FontCodeType::Tab)->second);
+		GlyphInfo* selectedGlyphInfo = createLazySpecialGlyph<LAMode>(nextGlyphIndex++, GlyphInfo(static_cast<Char>(FontCodeType::Selected), mSelectedWidth, height, 0.0f, 0.0f, 0.0f), charMask.find(FontCodeType::Selected)->second);
+		GlyphInfo* selectedBackGlyphInfo = createLazySpecialGlyph<LAMode>(nextGlyphIndex++, GlyphInfo(static_cast<Char>(FontCodeType::SelectedBack), mSelectedWidth, height, 0.0f, 0.0f, 0.0f), charMask.find(FontCodeType::SelectedBack)->second);
+		createLazySpecialGlyph<LAMode>(nextGlyphIndex++, GlyphInfo(static_cast<Char>(FontCodeType::Cursor), mCursorWidth, height, 0.0f, 0.0f, 0.0f), charMask.find(FontCodeType::Cursor)->second);
+
+		// Manually adjust the width of the selection glyphs to zero, as renderGlyphs() does.
+		if (selectedGlyphInfo != nullptr)
+		{
+			selectedGlyphInfo->width = 0.0f;
+			selectedGlyphInfo->uvRect.right = selectedGlyphInfo->uvRect.left;
+		}
+
+		if (selectedBackGlyphInfo != nullptr)
+		{
+			selectedBackGlyphInfo->width = 0.0f;
+			selectedBackGlyphInfo->uvRect.right = selectedBackGlyphInfo->uvRect.left;
+		}
+
+		// If the substitute code point doesn't exist in the font, revert to the "Not Defined" glyph.
+		if (mSubstituteCodePoint != FontCodeType::NotDefined && createLazyGlyph(mSubstituteCodePoint) == nullptr)
+			mSubstituteCodePoint = static_cast<Char>(FontCodeType::NotDefined);
+
+		if (mSubstituteCodePoint == FontCodeType::NotDefined)
+			createLazyGlyph<LAMode, Antialias>(static_cast<Char>(FontCodeType::NotDefined), 0);
+
+		// Cache a pointer to the substitute glyph info for fast lookup.
+		GlyphMap::iterator substituteIter = mGlyphMap.find(mSubstituteCodePoint);
+		mSubstituteGlyphInfo = (substituteIter != mGlyphMap.end()) ? &substituteIter->second : nullptr;
+
+		MYGUI_LOG(Info, "ResourceTrueTypeFont: Font '" << getResourceName() << "' using lazy glyph cache texture size " << texSize << " x " << texSize << " with " << pageCount << " pages.");
+		MYGUI_LOG(Info, "ResourceTrueTypeFont: Font '" << getResourceName() << "' using real height " << mDefaultHeight << " pixels.");
+	}
+
+	void ResourceTrueTypeFont::shutdownLazy()
+	{
+		if (mFtFace == nullptr)
+			return;
+
+		FT_Done_Face(mFtFace);
+		FT_Done_FreeType(mFtLibrary);
+
+		delete [] mFontBuffer;
+
+		mFtFace = nullptr;
+		mFtLibrary = nullptr;
+		mFontBuffer = nullptr;
+
+		mPages.clear();
+		mTextureData.clear();
+		mKerningCache.clear();
+	}
+
+	GlyphInfo* ResourceTrueTypeFont::createLazyGlyph(Char _codePoint)
+	{
+		CharMap::iterator iter = mCharMap.find(_codePoint);
+
+		if (iter == mCharMap.end())
+			return nullptr;
+
+		if (iter->second == 0)
+			iter->second = FT_Get_Char_Index(mFtFace, _codePoint);
+
+		// The code point is not supported by the font. Remove it from the character map so that the substitute is used without
+		// asking FreeType again.
+		if (iter->second == 0)
+		{
+			mCharMap.erase(iter);
+			return nullptr;
+		}
+
+		int init = (mLAMode ? 2 : 0) | (mAntialias ? 1 : 0);
+
+		switch (init)
+		{
+		case 0:
+			return createLazyGlyph<false, false>(_codePoint, iter->second);
+		case 1:
+			return createLazyGlyph<false, true>(_codePoint, iter->second);
+		case 2:
+			return createLazyGlyph<true, false>(_codePoint, iter->second);
+		case 3:
+			return createLazyGlyph<true, true>(_codePoint, iter->second);
+		}
+
+		return nullptr;
+	}
+
+	template<bool LAMode, bool Antialias>
+	GlyphInfo* ResourceTrueTypeFont::createLazyGlyph(Char _codePoint, FT_UInt _glyphIndex)
+	{
+		if (FT_Load_Glyph(mFtFace, _glyphIndex, mFtLoadFlags) != 0)
+		{
+			MYGUI_LOG(Warning, "ResourceTrueTypeFont: Cannot load glyph " << _glyphIndex << " for character " << _codePoint << " in font '" << getResourceName() << "'.");
+			mCharMap.erase(_codePoint);
+			return nullptr;
+		}
+
+		GlyphInfo info = createFaceGlyphInfo(_codePoint, mFontAscent, mFtFace->glyph);
+
+		int width = (int)ceil(info.width);
+		int height = (int)ceil(info.height);
+
+		if (width > 0 && height > 0)
+		{
+			int texX = 0;
+			int texY = 0;
+
+			if (!allocateLazyGlyph<LAMode>(width, height, texX, texY))
+			{
+				if (!mLazyCacheFull)
+				{
+					MYGUI_LOG(Warning, "ResourceTrueTypeFont: Glyph cache of font '" << getResourceName() << "' is full; increase LazyTextureSize.");
+					mLazyCacheFull = true;
+				}
+				return nullptr;
+			}
+
+			if (FT_Load_Glyph(mFtFace, _glyphIndex, mFtLoadFlags | FT_LOAD_RENDER) == 0)
+			{
+				FT_Bitmap ftBitmap;
+				FT_Bitmap_New(&ftBitmap);
+
+				uint8* glyphBuffer = getGlyphBitmap(mFtLibrary, mFtFace, ftBitmap);
+
+				if (glyphBuffer != nullptr)
+				{
+					IntCoord coord(texX, texY, width, height);
+					int texSize = mTexture->getWidth();
+
+					if (mUseDistanceField)
+						renderDistanceFieldGlyph(info, height, &mTextureData[0], texSize, texSize, texX, texY, glyphBuffer, mFtFace->glyph->bitmap.width, mFtFace->glyph->bitmap.rows);
+					else
+						renderGlyph<LAMode, true, Antialias>(info, charMaskWhite, charMaskWhite, charMaskWhite, height, &mTextureData[0], texSize, texSize, texX, texY, glyphBuffer);
+					updateLazyTexture(coord);
+				}
+
+				FT_Bitmap_Done(mFtLibrary, &ftBitmap);
+			}
+			else
+			{
+				MYGUI_LOG(Warning, "ResourceTrueTypeFont: Cannot render glyph " << _glyphIndex << " for character " << _codePoint << " in font '" << getResourceName() << "'.");
+			}
+		}
+
+		mCharMap[_codePoint] = _glyphIndex;
+		return &insertGlyphInfo(_codePoint, info);
+	}
+
+	template<bool LAMode>
+	GlyphInfo* ResourceTrueTypeFont::createLazySpecialGlyph(FT_UInt _glyphIndex, const GlyphInfo& _glyphInfo, uint8 _alpha)
+	{
+		GlyphInfo info = _glyphInfo;
+
+		int width = (int)ceil(info.width);
+		int height = (int)ceil(info.height);
+		int texX = 0;
+		int texY = 0;
+
+		if (width > 0 && height > 0 && !allocateLazyGlyph<LAMode>(width, height, texX, texY))
+			return nullptr;
+
+		IntCoord coord(texX, texY, width, height);
+		int texSize = mTexture->getWidth();
+
+		renderGlyph<LAMode, false, false>(info, charMaskWhite, charMaskBlack, _alpha, height, &mTextureData[0], texSize, texSize, texX, texY);
+
+		if (width > 0 && height > 0)
+			updateLazyTexture(coord);
+
+		mCharMap[info.codePoint] = _glyphIndex;
+		return &insertGlyphInfo(info.codePoint, info);
+	}
+
+	template<bool LAMode>
+	bool ResourceTrueTypeFont::allocateLazyGlyph(int _width, int _height, int& _texX, int& _texY)
+	{
+		size_t frame = RenderManager::getInstance()._getFrameNumber();
+
+		for (size_t index = 0; index < mPages.size(); ++index)
+		{
+			if (!mPages[index].cleared)
+				clearLazyPage<LAMode>(index);
+
+			if (allocateLazyGlyphOnPage(mPages[index], _width, _height, _texX, _texY))
+			{
+				mPages[index].lastUsed = frame;
+				return true;
+			}
+		}
+
+		// Find the least recently used page. The first page holds the special glyphs and is never evicted.
+		size_t oldest = 1;
+		for (size_t index = 2; index < mPages.size(); ++index)
+		{
+			if (mPages[index].lastUsed < mPages[oldest].lastUsed)
+				oldest = index;
+		}
+
+		// Glyphs requested in the current frame may still be waiting to be rendered, so their page must stay.
+		if (mPages[oldest].lastUsed >= frame)
+			return false;
+
+		evictLazyPage<LAMode>(oldest);
+
+		if (!allocateLazyGlyphOnPage(mPages[oldest], _width, _height, _texX, _texY))
+			return false;
+
+		mPages[oldest].lastUsed = frame;
+		return true;
+	}
+
+	bool ResourceTrueTypeFont::allocateLazyGlyphOnPage(GlyphPage& _page, int _width, int _height, int& _texX, int& _texY)
+	{
+		int texSize = mTexture->getWidth();
+
+		int left = _page.shelfLeft;
+		int top = _page.shelfTop;
+		int shelfHeight = _page.shelfHeight;
+
+		// Start a new shelf if the glyph doesn't fit at the end of the current one, the same way as autoWrapGlyphPos() does.
+		if (left + mGlyphSpacing + _width + mGlyphSpacing > texSize)
+		{
+			top += shelfHeight;
+			left = 0;
+			shelfHeight = 0;
+		}
+
+		if (top + mGlyphSpacing + _height > _page.bottom || mGlyphSpacing + _width + mGlyphSpacing > texSize)
+			return false;
+
+		_texX = left + mGlyphSpacing;
+		_texY = top + mGlyphSpacing;
+
+		_page.shelfLeft = _texX + _width;
+		_page.shelfTop = top;
+		_page.shelfHeight = (std::max)(shelfHeight, mGlyphSpacing + _height);
+		return true;
+	}
+
+	template<bool LAMode>
+	void ResourceTrueTypeFont::evictLazyPage(size_t _index)
+	{
+		for (GlyphMap::iterator iter = mGlyphMap.begin(); iter != mGlyphMap.end(); )
+		{
+			if (getLazyPage(iter->second) == _index)
+			{
+				mGlyphTable.erase(iter->first);
+				mGlyphMap.erase(iter++);
+			}
+			else
+				++iter;
+		}
+
+		clearLazyPage<LAMode>(_index);
+
+		// Text that is already laid out still refers to the evicted glyphs, so lay out everything again on the next frame.
+		FontManager::getInstance().getTextLayoutCache().removeFont(this);
+		RenderManager::getInstance()._requestFullUpdate();
+	}
+
+	template<bool LAMode>
+	void ResourceTrueTypeFont::clearLazyPage(size_t _index)
+	{
+		GlyphPage& page = mPages[_index];
+		int texSize = mTexture->getWidth();
+
+		// Pages are used from top to bottom, so the copy of the texture only grows at its end.
+		size_t size = page.bottom * texSize * Pixel<LAMode>::getNumBytes();
+		if (mTextureData.size() < size)
+			mTextureData.resize(size);
+
+		// Make the first row transparent white and copy it to the rest of the page.
+		size_t rowSize = texSize * Pixel<LAMode>::getNumBytes();
+		uint8* firstRow = &mTextureData[page.top * rowSize];
+		for (uint8* dest = firstRow, * endDest = dest + rowSize; dest != endDest; )
+			Pixel<LAMode, false, false>::set(dest, charMaskWhite, charMaskBlack);
+
+		for (int row = page.top + 1; row < page.bottom; ++row)
+			memcpy(&mTextureData[row * rowSize], firstRow, rowSize);
+
+		page.shelfLeft = 0;
+		page.shelfTop = page.top;
+		page.shelfHeight = 0;
+		page.cleared = true;
+
+		updateLazyTexture(IntCoord(0, page.top, texSize, page.bottom - page.top));
+	}
+
+	size_t ResourceTrueTypeFont::getLazyPage(const GlyphInfo& _info) const
+	{
+		// Glyphs without pixels have empty texture coordinates and are treated as part of the first page.
+		int texY = (int)(_info.uvRect.top * (float)mPages.back().bottom + 0.5f);
+		return (std::min)((size_t)(texY / mPageHeight), mPages.size() - 1);
+	}
+
+	void ResourceTrueTypeFont::updateLazyTexture(const IntCoord& _coord)
+	{
+		if (mTexture->updateRegion(_coord, &mTextureData[0]))
+			return;
+
+		uint8* texBuffer = static_cast<uint8*>(mTexture->lock(TextureUsage::Write));
+
+		if (texBuffer != nullptr)
+		{
+			memcpy(texBuffer, &mTextureData[0], mTextureData.size());
+			mTexture->unlock();
+		}
+		else
+		{
+			MYGUI_LOG(Error, "ResourceTrueTypeFont: Error locking texture; pointer is nullptr.");
+		}
+	}
+
 	void ResourceTrueTypeFont::setSource(const std::string& _value)
 	{
 		mSource = _value;
@@ -1060,6 +2180,133 @@ namespace MyGUI
 		mGlyphSpacing = _value;
 	}
 
+	void ResourceTrueTypeFont::setLazy(bool _value)
+	{
+		mLazy = _value;
+	}
+
+	void ResourceTrueTypeFont::setLazyTextureSize(int _value)
+	{
+		mLazyTextureSize = _value;
+	}
+
+	void ResourceTrueTypeFont::setLazyPageCount(int _value)
+	{
+		mLazyPageCount = _value;
+	}
+
+	void ResourceTrueTypeFont::setRenderThreadCount(size_t _value)
+	{
+		renderThreadCount = _value;
+	}
+
+	void ResourceTrueTypeFont::setDistanceField(bool _value)
+	{
+		mDistanceField = _value;
+	}
+
+	void ResourceTrueTypeFont::setDistanceFieldSpread(int _value)
+	{
+		mDistanceFieldSpread = (std::max)(_value, 1);
+	}
+
+	void ResourceTrueTypeFont::setCache(const std::string& _value)
+	{
+		mCache = _value;
+	}
+
+	void ResourceTrueTypeFont::setKerning(bool _value)
+	{
+		mKerning = _value;
+	}
+
+	bool ResourceTrueTypeFont::saveCache(const std::string& _fileName)
+	{
+		if (mLazy || mTexture == nullptr || mCacheKey.empty())
+		{
+			MYGUI_LOG(Error, "ResourceTrueTypeFont: Font '" << getResourceName() << "' can't be cached; only initialised fonts that are not lazy can be cached.");
+			return false;
+		}
+
+		std::string data(fontCacheSignature, sizeof(fontCacheSignature) - 1);
+		std::string key = mCacheKey;
+
+		if (!addSourceToCacheKey(key))
+		{
+			MYGUI_LOG(Error, "ResourceTrueTypeFont: Can't read source '" << mSource << "' of font '" << getResourceName() << "'.");
+			return false;
+		}
+
+		writeCacheValue(data, fontCacheVersion);
+		writeCacheValue(data, (uint32)key.size());
+		data += key;
+
+		bool laMode = mTexture->getFormat() == Pixel<true>::getFormat();
+
+		writeCacheValue(data, mDefaultHeight);
+		writeCacheValue(data, mTabWidth);
+		writeCacheValue(data, mSubstituteCodePoint);
+		writeCacheValue(data, mTexture->getWidth());
+		writeCacheValue(data, mTexture->getHeight());
+		writeCacheValue(data, laMode);
+
+		// Write the glyphs ordered by code point, so that the same font always produces the same file.
+		std::map<Char, const GlyphInfo*> glyphs;
+
+		for (GlyphMap::const_iterator iter = mGlyphMap.begin(); iter != mGlyphMap.end(); ++iter)
+			glyphs[iter->first] = &iter->second;
+
+		writeCacheValue(data, (uint32)mCharMap.size());
+		writeCacheValue(data, (uint32)glyphs.size());
+
+		for (CharMap::const_iterator iter = mCharMap.begin(); iter != mCharMap.end(); ++iter)
+		{
+			writeCacheValue(data, iter->first);
+			writeCacheValue(data, iter->second);
+		}
+
+		for (std::map<Char, const GlyphInfo*>::const_iterator iter = glyphs.begin(); iter != glyphs.end(); ++iter)
+		{
+			const GlyphInfo& info = *iter->second;
+
+			writeCacheValue(data, info.codePoint);
+			writeCacheValue(data, info.width);
+			writeCacheValue(data, info.height);
+			writeCacheValue(data, info.advance);
+			writeCacheValue(data, info.bearingX);
+			writeCacheValue(data, info.bearingY);
+			writeCacheValue(data, info.uvRect.left);
+			writeCacheValue(data, info.uvRect.top);
+			writeCacheValue(data, info.uvRect.right);
+			writeCacheValue(data, info.uvRect.bottom);
+		}
+
+		std::ofstream stream(_fileName.c_str(), std::ios_base::out | std::ios_base::binary);
+
+		if (!stream.is_open())
+		{
+			MYGUI_LOG(Error, "ResourceTrueTypeFont: Can't write cache '" << _fileName << "' of font '" << getResourceName() << "'.");
+			return false;
+		}
+
+		const char* texBuffer = static_cast<const char*>(mTexture->lock(TextureUsage::Read));
+
+		if (texBuffer == nullptr)
+		{
+			MYGUI_LOG(Error, "ResourceTrueTypeFont: Error locking texture; pointer is nullptr.");
+			return false;
+		}
+
+		size_t texSize = mTexture->getWidth() * mTexture->getHeight() * (laMode ? Pixel<true>::getNumBytes() : Pixel<false>::getNumBytes());
+
+		stream.write(data.data(), data.size());
+		stream.write(texBuffer, texSize);
+
+		mTexture->unlock();
+
+		return stream.good();
+	}
+
 #endif // MYGUI_USE_FREETYPE
 
 } // namespace MyGUI
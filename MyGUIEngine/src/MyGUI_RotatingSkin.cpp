@@ -35,7 +35,7 @@ namespace MyGUI
 		mGeometryOutdated = true;
 
 		if (nullptr != mNode)
-			mNode->outOfDate(mRenderItem);
+			mNode->outOfDate(mRenderItem, this);
 	}
 
 	void RotatingSkin::setCenter(const IntPoint& _center)
@@ -44,7 +44,7 @@ namespace MyGUI
 		mGeometryOutdated = true;
 
 		if (nullptr != mNode)
-			mNode->outOfDate(mRenderItem);
+			mNode->outOfDate(mRenderItem, this);
 	}
 
 	IntPoint RotatingSkin::getCenter(bool _local) const
@@ -61,7 +61,7 @@ namespace MyGUI
 		mGeometryOutdated = true;
 
 		if (nullptr != mNode)
-			mNode->outOfDate(mRenderItem);
+			mNode->outOfDate(mRenderItem, this);
 	}
 
 	void RotatingSkin::setAlpha(float _alpha)
@@ -70,7 +70,7 @@ namespace MyGUI
 		mCurrentColour = (mCurrentColour & 0x00FFFFFF) | (alpha & 0xFF000000);
 
 		if (nullptr != mNode)
-			mNode->outOfDate(mRenderItem);
+			mNode->outOfDate(mRenderItem, this);
 	}
 
 	void RotatingSkin::_correctView()
@@ -78,7 +78,7 @@ namespace MyGUI
 		mGeometryOutdated = true;
 
 		if (nullptr != mNode)
-			mNode->outOfDate(mRenderItem);
+			mNode->outOfDate(mRenderItem, this);
 	}
 
 	void RotatingSkin::_setAlign(const IntSize& _oldsize)
@@ -141,7 +141,7 @@ namespace MyGUI
 		mGeometryOutdated = true;
 
 		if (nullptr != mNode)
-			mNode->outOfDate(mRenderItem);
+			mNode->outOfDate(mRenderItem, this);
 	}
 
 	void RotatingSkin::createDrawItem(ITexture* _texture, ILayerNode* _node)
@@ -194,7 +194,7 @@ namespace MyGUI
 		mCurrentColour = (colour & 0x00FFFFFF) | (mCurrentColour & 0xFF000000);
 
 		if (nullptr != mNode)
-			mNode->outOfDate(mRenderItem);
+			mNode->outOfDate(mRenderItem, this);
 	}
 
 	void RotatingSkin::setStateData(IStateInfo* _data)
@@ -214,7 +214,7 @@ namespace MyGUI
 		mGeometryOutdated = true;
 
 		if (nullptr != mNode)
-			mNode->outOfDate(mRenderItem);
+			mNode->outOfDate(mRenderItem, this);
 	}
 
 	inline float len(float x, float y)
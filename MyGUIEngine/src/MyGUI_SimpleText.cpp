@@ -43,7 +43,7 @@ namespace MyGUI
 		if (mTextOutDate)
 			updateRawData();
 
-		const IntSize& size = mTextView.getViewSize();
+		const IntSize& size = getTextView().getViewSize();
 
 		if (mTextAlign.isRight())
 			mViewOffset.left = - (mCoord.width - size.width);
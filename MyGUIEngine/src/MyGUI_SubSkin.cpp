@@ -39,7 +39,7 @@ namespace MyGUI
 		mVisible = _visible;
 
 		if (nullptr != mNode)
-			mNode->outOfDate(mRenderItem);
+			mNode->outOfDate(mRenderItem, this);
 	}
 
 	void SubSkin::setAlpha(float _alpha)
@@ -48,13 +48,13 @@ namespace MyGUI
 		mCurrentColour = (mCurrentColour & 0x00FFFFFF) | (alpha & 0xFF000000);
 
 		if (nullptr != mNode)
-			mNode->outOfDate(mRenderItem);
+			mNode->outOfDate(mRenderItem, this);
 	}
 
 	void SubSkin::_correctView()
 	{
 		if (nullptr != mNode)
-			mNode->outOfDate(mRenderItem);
+			mNode->outOfDate(mRenderItem, this);
 	}
 
 	void SubSkin::_setAlign(const IntSize& _oldsize)
@@ -131,7 +131,7 @@ namespace MyGUI
 
 				// обновить перед выходом
 				if (nullptr != mNode)
-					mNode->outOfDate(mRenderItem);
+					mNode->outOfDate(mRenderItem, this);
 				return;
 			}
 		}
@@ -172,7 +172,7 @@ namespace MyGUI
 		mIsMargin = margin;
 
 		if (nullptr != mNode)
-			mNode->outOfDate(mRenderItem);
+			mNode->outOfDate(mRenderItem, this);
 	}
 
 	void SubSkin::createDrawItem(ITexture* _texture, ILayerNode* _node)
@@ -224,7 +224,7 @@ namespace MyGUI
 		}
 
 		if (nullptr != mNode)
-			mNode->outOfDate(mRenderItem);
+			mNode->outOfDate(mRenderItem, this);
 	}
 
 	void SubSkin::doRender()
@@ -265,7 +265,7 @@ namespace MyGUI
 		mCurrentColour = (colour & 0x00FFFFFF) | (mCurrentColour & 0xFF000000);
 
 		if (nullptr != mNode)
-			mNode->outOfDate(mRenderItem);
+			mNode->outOfDate(mRenderItem, this);
 	}
 
 	void SubSkin::setStateData(IStateInfo* _data)
@@ -169,37 +169,106 @@ namespace MyGUI
 		if (mSize != ITEM_NONE) return mSize;
 		mSize = mPosition;
 
-		for (UString::iterator iter = mCurrent; iter != mEnd; ++iter)
-		{
+		skipChars(mCurrent - mText.begin(), mSize, ITEM_NONE);
 
-			if ((*iter) == L'#')
+		return mSize;
+	}
+
+	size_t TextIterator::skipChars(size_t _index, size_t& _count, size_t _max) const
+	{
+		// по указателю, итераторы строки слишком медленные для длинного текста
+		const UString::code_point* text = mText.c_str();
+		size_t size = mText.size();
+
+		while (_index < size)
+		{
+			if (text[_index] == L'#')
 			{
 				// следующий символ
-				++ iter;
-				if (iter == mEnd) break;
+				++ _index;
+				if (_index == size) break;
 
-				// тэг цвета
-				if ((*iter) != L'#')
+				// тэг цвета, остальные 5 символов цвета
+				if (text[_index] != L'#')
 				{
-					// остальные 5 символов цвета
-					for (size_t pos = 0; pos < 5; pos++)
+					_index = (std::min)(_index + 6, size);
+					continue;
+				}
+			}
+
+			if (_count == _max) return _index;
+
+			// обыкновенный символ
+			_count ++;
+			_index ++;
+		}
+
+		return size;
+	}
+
+	bool TextIterator::moveToPosition(size_t _position, UString* _colour)
+	{
+		if (mCurrent == mEnd) return false;
+		mFirst = false;
+
+		const UString::code_point* text = mText.c_str();
+		size_t size = mText.size();
+		size_t index = mCurrent - mText.begin();
+		// начало последнего тега цвета
+		size_t colour = ITEM_NONE;
+		bool result = true;
+
+		while (result && mPosition != _position)
+		{
+			// теги перед символом, так же как в getTagColour
+			if (_colour != nullptr)
+			{
+				for (size_t tag = index; tag + 6 < size && text[tag] == L'#' && text[tag + 1] != L'#'; tag += 7)
+					colour = tag;
+			}
+
+			// ставим на следующий символ так же как в moveNext
+			result = false;
+			for (size_t next = index; next < size; ++next)
+			{
+				if (text[next] == L'#')
+				{
+					// следующий символ
+					++ next;
+					if (next == size)
 					{
-						++ iter;
-						if (iter == mEnd)
+						index = size;
+						break;
+					}
+
+					// тэг цвета, остальные 5 символов цвета
+					if (text[next] != L'#')
+					{
+						next += 5;
+						if (next >= size)
 						{
-							--iter;
+							index = size;
 							break;
 						}
+						continue;
 					}
-					continue;
 				}
-			}
 
-			// обыкновенный символ
-			mSize ++;
+				// обыкновенный символ или две решетки подряд
+				mPosition ++;
+				++ next;
+				if (next != size)
+					result = true;
+				index = next;
+				break;
+			}
 		}
 
-		return mSize;
+		mCurrent = mText.begin() + index;
+		if (colour != ITEM_NONE)
+			_colour->assign(text + colour, 7);
+
+		return result;
 	}
 
 	// возвращает текст без тегов
@@ -422,44 +491,14 @@ namespace MyGUI
 
 		mSize = mPosition;
 
-		for (UString::iterator iter = mCurrent; iter != mEnd; ++iter)
+		size_t index = skipChars(mCurrent - mText.begin(), mSize, _max);
+		if (index != mText.size())
 		{
-
-			if ((*iter) == L'#')
-			{
-				// следующий символ
-				++ iter;
-				if (iter == mEnd) break;
-
-				// тэг цвета
-				if ((*iter) != L'#')
-				{
-					// остальные 5 символов цвета
-					for (size_t pos = 0; pos < 5; pos++)
-					{
-						++ iter;
-						if (iter == mEnd)
-						{
-							-- iter;
-							break;
-						}
-					}
-					continue;
-				}
-			}
-
-			// проверяем и обрезаем
-			if (mSize == _max)
-			{
-				mPosition = mSize; // сохраняем
-				mCurrent = erase(iter, mEnd);
-				mSave = mEnd = mText.end();
-				mSize = mPosition; // восстанавливаем
-				return;
-			}
-
-			// увеличиваем
-			mSize ++;
+			// обрезаем
+			mPosition = mSize; // сохраняем
+			mCurrent = erase(mText.begin() + index, mEnd);
+			mSave = mEnd = mText.end();
+			mSize = mPosition; // восстанавливаем
 		}
 	}
 
@@ -0,0 +1,225 @@
+/*
+ * This source file is part of MyGUI. For the latest info, see http://mygui.info/
+ * Distributed under the MIT License
+ * (See accompanying file COPYING.MIT or copy at http://opensource.org/licenses/MIT)
+ */
+
+#include "MyGUI_Precompiled.h"
+#include "MyGUI_TextLayoutCache.h"
+#include "MyGUI_RenderManager.h"
+
+namespace MyGUI
+{
+
+	const size_t TEXT_LAYOUT_CACHE_DEFAULT_CAPACITY = 1024;
+	const size_t TEXT_LAYOUT_CACHE_DEFAULT_MAX_TEXT_LENGTH = 256;
+
+	TextLayoutCache::TextLayoutCache() :
+		mCapacity(TEXT_LAYOUT_CACHE_DEFAULT_CAPACITY),
+		mMaxTextLength(TEXT_LAYOUT_CACHE_DEFAULT_MAX_TEXT_LENGTH),
+		mHits(0),
+		mMisses(0),
+		mGeneration(0)
+	{
+	}
+
+	TextLayoutCache::~TextLayoutCache()
+	{
+		for (MapEntry::iterator item = mEntries.begin(); item != mEntries.end(); ++item)
+			delete item->second;
+		mEntries.clear();
+		mUnused.clear();
+	}
+
+	const TextView* TextLayoutCache::acquire(const UString& _text, IFont* _font, int _height, Align _align, VertexColourType _format, int _maxWidth)
+	{
+		// FNV-1a of text and other parameters
+		size_t hash = 2166136261U;
+		const UString::code_point* text = _text.c_str();
+		for (size_t index = 0; index < _text.size(); ++index)
+			hash = (hash ^ text[index]) * 16777619U;
+		hash = (hash ^ reinterpret_cast<size_t>(_font)) * 16777619U;
+		hash = (hash ^ (size_t)_height) * 16777619U;
+		hash = (hash ^ (size_t)_align.getValue()) * 16777619U;
+		hash = (hash ^ (size_t)_format.getValue()) * 16777619U;
+		hash = (hash ^ (size_t)_maxWidth) * 16777619U;
+
+		std::pair<MapEntry::iterator, MapEntry::iterator> range = mEntries.equal_range(hash);
+		for (MapEntry::iterator item = range.first; item != range.second; ++item)
+		{
+			Entry* entry = item->second;
+			if (entry->font != _font
+				|| entry->height != _height
+				|| entry->align != _align
+				|| entry->format != _format
+				|| entry->maxWidth != _maxWidth
+				|| entry->text != _text)
+				continue;
+
+			if (entry->references == 0)
+				mUnused.erase(entry->unused);
+			entry->references ++;
+
+			mHits ++;
+			RenderManager* render = RenderManager::getInstancePtr();
+			if (render != nullptr)
+				++render->_getFrameStatistics().textLayoutCacheHits;
+			return entry;
+		}
+
+		mMisses ++;
+
+		Entry* entry = new Entry();
+		entry->hash = hash;
+		entry->text = _text;
+		entry->font = _font;
+		entry->height = _height;
+		entry->align = _align;
+		entry->format = _format;
+		entry->maxWidth = _maxWidth;
+		entry->references = 1;
+
+		size_t generation = mGeneration;
+		entry->update(_text, _font, _height, _align, _format, _maxWidth);
+
+		// glyphs requested by layout could evict other glyphs of font, then layout is used only once
+		entry->cached = generation == mGeneration;
+		if (entry->cached)
+			mEntries.insert(MapEntry::value_type(hash, entry));
+		return entry;
+	}
+
+	void TextLayoutCache::release(const TextView* _view)
+	{
+		// all layouts given by acquire are entries
+		Entry* entry = static_cast<Entry*>(const_cast<TextView*>(_view));
+		MYGUI_ASSERT(entry->references != 0, "Text layout released more times than acquired");
+
+		entry->references --;
+		if (entry->references != 0)
+			return;
+
+		if (!entry->cached)
+		{
+			delete entry;
+			return;
+		}
+
+		mUnused.push_front(entry);
+		entry->unused = mUnused.begin();
+		removeUnused(mCapacity);
+	}
+
+	void TextLayoutCache::removeFont(IFont* _font)
+	{
+		mGeneration ++;
+
+		MapEntry::iterator item = mEntries.begin();
+		while (item != mEntries.end())
+		{
+			Entry* entry = item->second;
+			if (entry->font != _font)
+			{
+				++item;
+				continue;
+			}
+
+			mEntries.erase(item++);
+			entry->cached = false;
+			if (entry->references == 0)
+			{
+				mUnused.erase(entry->unused);
+				delete entry;
+			}
+		}
+	}
+
+	void TextLayoutCache::clear()
+	{
+		mGeneration ++;
+
+		for (MapEntry::iterator item = mEntries.begin(); item != mEntries.end(); ++item)
+		{
+			Entry* entry = item->second;
+			entry->cached = false;
+			if (entry->references == 0)
+				delete entry;
+		}
+		mEntries.clear();
+		mUnused.clear();
+	}
+
+	void TextLayoutCache::removeEntry(Entry* _entry)
+	{
+		std::pair<MapEntry::iterator, MapEntry::iterator> range = mEntries.equal_range(_entry->hash);
+		for (MapEntry::iterator item = range.first; item != range.second; ++item)
+		{
+			if (item->second == _entry)
+			{
+				mEntries.erase(item);
+				break;
+			}
+		}
+
+		delete _entry;
+	}
+
+	void TextLayoutCache::removeUnused(size_t _count)
+	{
+		while (mUnused.size() > _count)
+		{
+			Entry* entry = mUnused.back();
+			mUnused.pop_back();
+			removeEntry(entry);
+		}
+	}
+
+	void TextLayoutCache::setCapacity(size_t _value)
+	{
+		mCapacity = _value;
+		removeUnused(mCapacity);
+	}
+
+	size_t TextLayoutCache::getCapacity() const
+	{
+		return mCapacity;
+	}
+
+	void TextLayoutCache::setMaxTextLength(size_t _value)
+	{
+		mMaxTextLength = _value;
+	}
+
+	size_t TextLayoutCache::getMaxTextLength() const
+	{
+		return mMaxTextLength;
+	}
+
+	size_t TextLayoutCache::getSize() const
+	{
+		return mEntries.size();
+	}
+
+	size_t TextLayoutCache::getHits() const
+	{
+		return mHits;
+	}
+
+	size_t TextLayoutCache::getMisses() const
+	{
+		return mMisses;
+	}
+
+	float TextLayoutCache::getHitRate() const
+	{
+		size_t total = mHits + mMisses;
+		return total != 0 ? (float)mHits / (float)total : 0.0f;
+	}
+
+	void TextLayoutCache::resetStatistics()
+	{
+		mHits = 0;
+		mMisses = 0;
+	}
+
+} // namespace MyGUI
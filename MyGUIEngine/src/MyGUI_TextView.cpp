@@ -6,6 +6,8 @@
 
 #include "MyGUI_Precompiled.h"
 #include "MyGUI_TextView.h"
+#include "MyGUI_Profiler.h"
+#include "MyGUI_RenderManager.h"
 
 namespace MyGUI
 {
@@ -27,6 +29,20 @@ namespace MyGUI
 				_var = _newValue;
 		}
 
+		// заменяет элементы [_first, _last) на _items, содержимое _items при этом теряется
+		template<typename T>
+		void replaceRange(std::vector<T>& _data, size_t _first, size_t _last, std::vector<T>& _items)
+		{
+			size_t common = (std::min)(_last - _first, _items.size());
+			for (size_t index = 0; index < common; ++index)
+				std::swap(_data[_first + index], _items[index]);
+
+			if (_items.size() > common)
+				_data.insert(_data.begin() + _last, _items.begin() + common, _items.end());
+			else
+				_data.erase(_data.begin() + _first + common, _data.begin() + _last);
+		}
+
 	}
 
 	class RollBackPoint
@@ -93,13 +109,30 @@ namespace MyGUI
 
 	TextView::TextView() :
 		mLength(0),
-		mFontHeight(0)
+		mFontHeight(0),
+		mFont(nullptr),
+		mMaxWidth(-1)
 	{
 	}
 
 	void TextView::update(const UString& _text, IFont* _font, int _height, Align _align, VertexColourType _format, int _maxWidth)
 	{
+		MYGUI_PROFILE_ZONE("TextView::update");
+		RenderManager* render = RenderManager::getInstancePtr();
+		if (render != nullptr)
+			++render->_getFrameStatistics().textViewUpdates;
+
+		// строки до первой измененной не пересчитываем, как и строки после переноса в одинаковом конце текста
+		size_t first_line = 0;
+		size_t same_end = 0;
+		getChange(_text, _font, _height, _format, _maxWidth, first_line, same_end);
+
+		size_t old_size = mText.size();
+		mText = _text;
+		mFont = _font;
 		mFontHeight = _height;
+		mFormat = _format;
+		mMaxWidth = _maxWidth;
 
 		// массив для быстрой конвертации цветов
 		static const char convert_colour[64] =
@@ -113,21 +146,23 @@ namespace MyGUI
 		mViewSize.clear();
 
 		RollBackPoint roll_back;
-		IntSize result;
 		float width = 0.0f;
 		size_t count = 0;
-		mLength = 0;
-		mLineInfo.clear();
+		size_t line_start = first_line != 0 ? mLineStart[first_line] : 0;
+		// новые строки вместо старых начиная с first_line
+		VectorLineInfo lines;
+		std::vector<size_t> line_starts;
+		// старая строка, с которой строки остались прежними, или ITEM_NONE
+		size_t same_line = ITEM_NONE;
 		LineInfo line_info;
 		int font_height = _font->getDefaultHeight();
+		bool kerning = _font->hasKerning();
+		// предыдущий символ строки для кернинга
+		Char previous = 0;
 
+		UString::const_iterator begin = _text.begin();
 		UString::const_iterator end = _text.end();
-		UString::const_iterator index = _text.begin();
-
-		/*if (index == end)
-			return;*/
-
-		result.height += _height;
+		UString::const_iterator index = begin + line_start;
 
 		for (; index != end; ++index)
 		{
@@ -148,18 +183,25 @@ namespace MyGUI
 
 				line_info.width = (int)ceil(width);
 				line_info.count = count;
-				mLength += line_info.count + 1;
-
-				result.height += _height;
-				setMax(result.width, line_info.width);
 				width = 0;
 				count = 0;
 
-				mLineInfo.push_back(line_info);
+				lines.push_back(line_info);
+				line_starts.push_back(line_start);
 				line_info.clear();
+				line_start = (index - begin) + 1;
 
 				// отменяем откат
 				roll_back.clear();
+				previous = 0;
+
+				// перенос в одинаковом конце текста, дальше строки такие же как раньше
+				if (line_start + same_end > _text.size())
+				{
+					same_line = findLine(line_start + old_size - _text.size(), first_line + 1);
+					if (same_line != ITEM_NONE)
+						break;
+				}
 
 				continue;
 			}
@@ -223,6 +265,14 @@ namespace MyGUI
 			float char_bearingX = info->bearingX;
 			float char_bearingY = info->bearingY;
 
+			// кернинг сдвигает символ и все символы после него
+			if (kerning)
+			{
+				if (previous != 0)
+					char_bearingX += _font->getKerning(previous, character);
+				previous = character;
+			}
+
 			if (_height != font_height)
 			{
 				float scale = (float)_height / font_height;
@@ -250,18 +300,17 @@ namespace MyGUI
 				// запоминаем место отката, как полную строку
 				line_info.width = (int)ceil(width);
 				line_info.count = count;
-				mLength += line_info.count + 1;
-
-				result.height += _height;
-				setMax(result.width, line_info.width);
 				width = 0;
 				count = 0;
 
-				mLineInfo.push_back(line_info);
+				lines.push_back(line_info);
+				line_starts.push_back(line_start);
 				line_info.clear();
+				line_start = (index - begin) + 1;
 
 				// отменяем откат
 				roll_back.clear();
+				previous = 0;
 
 				continue;
 			}
@@ -271,13 +320,79 @@ namespace MyGUI
 			count ++;
 		}
 
-		line_info.width = (int)ceil(width);
-		line_info.count = count;
-		mLength += line_info.count;
+		if (same_line == ITEM_NONE)
+		{
+			line_info.width = (int)ceil(width);
+			line_info.count = count;
+
+			lines.push_back(line_info);
+			line_starts.push_back(line_start);
+		}
+
+		// заменяем пересчитанные строки, оставшиеся старые строки сдвигаем
+		size_t last_line = same_line != ITEM_NONE ? same_line : mLineInfo.size();
+		size_t new_same_line = first_line + lines.size();
+		size_t old_same_position = same_line != ITEM_NONE ? mLinePosition[same_line] : 0;
+		std::vector<size_t> placeholder(lines.size());
+
+		replaceRange(mLineInfo, first_line, last_line, lines);
+		replaceRange(mLineStart, first_line, last_line, line_starts);
+		replaceRange(mLinePosition, first_line, last_line, placeholder);
+		replaceRange(mColourLine, first_line, last_line, placeholder);
+
+		// начала новых строк в позициях курсора и последний цвет перед ними
+		for (size_t line = first_line; line <= new_same_line && line < mLineInfo.size(); ++line)
+		{
+			if (line == 0)
+			{
+				mLinePosition[line] = 0;
+				mColourLine[line] = ITEM_NONE;
+				continue;
+			}
+
+			const LineInfo& prev_line = mLineInfo[line - 1];
+			size_t position = mLinePosition[line - 1] + prev_line.count + 1;
+
+			size_t colour_line = mColourLine[line - 1];
+			for (VectorCharInfo::const_iterator sim = prev_line.simbols.begin(); sim != prev_line.simbols.end(); ++sim)
+			{
+				if (sim->isColour())
+				{
+					colour_line = line - 1;
+					break;
+				}
+			}
+
+			// старые строки сдвигаются вместе с первой из них
+			if (line == new_same_line)
+			{
+				size_t colour_before = colour_line;
+				for (size_t same = line; same < mLineInfo.size(); ++same)
+				{
+					mLineStart[same] = mLineStart[same] + _text.size() - old_size;
+					mLinePosition[same] = mLinePosition[same] + position - old_same_position;
+					if (mColourLine[same] == ITEM_NONE || mColourLine[same] < same_line)
+						mColourLine[same] = colour_before;
+					else
+						mColourLine[same] = mColourLine[same] - same_line + new_same_line;
+				}
+				break;
+			}
 
-		mLineInfo.push_back(line_info);
+			mLinePosition[line] = position;
+			mColourLine[line] = colour_line;
+		}
 
-		setMax(result.width, line_info.width);
+		IntSize result;
+		mLength = 0;
+		for (VectorLineInfo::const_iterator line = mLineInfo.begin(); line != mLineInfo.end(); ++line)
+		{
+			mLength += line->count + 1;
+			result.height += _height;
+			setMax(result.width, line->width);
+		}
+		// после последней строки переноса нет
+		mLength --;
 
 		// теперь выравниванием строки
 		for (VectorLineInfo::iterator line = mLineInfo.begin(); line != mLineInfo.end(); ++line)
@@ -286,12 +401,57 @@ namespace MyGUI
 				line->offset = result.width - line->width;
 			else if (_align.isHCenter())
 				line->offset = (result.width - line->width) / 2;
+			else
+				line->offset = 0;
 		}
 
 		mViewSize = result;
 	}
 
-	size_t TextView::getCursorPosition(const IntPoint& _value)
+	void TextView::invalidate()
+	{
+		mFont = nullptr;
+	}
+
+	void TextView::getChange(const UString& _text, IFont* _font, int _height, VertexColourType _format, int _maxWidth, size_t& _firstLine, size_t& _sameEnd) const
+	{
+		_firstLine = 0;
+		_sameEnd = 0;
+
+		if (mLineInfo.empty() || _font != mFont || _height != mFontHeight || _format != mFormat || _maxWidth != mMaxWidth)
+			return;
+
+		// длинна одинакового начала текста
+		const UString::code_point* text = _text.c_str();
+		const UString::code_point* old_text = mText.c_str();
+		size_t length = (std::min)(_text.size(), mText.size());
+		size_t same = 0;
+		while (same < length && text[same] == old_text[same])
+			++same;
+
+		// и одинакового конца, не пересекающегося с началом
+		while (_sameEnd < length - same && text[_text.size() - _sameEnd - 1] == old_text[mText.size() - _sameEnd - 1])
+			++_sameEnd;
+
+		// последняя строка, начинающаяся не позже изменения (последнюю строку пересчитываем всегда)
+		size_t line = std::upper_bound(mLineStart.begin(), mLineStart.end(), same) - mLineStart.begin() - 1;
+
+		// и предыдущая, изменение могло задеть ее перенос слов или CR перед LF
+		_firstLine = line != 0 ? line - 1 : 0;
+	}
+
+	size_t TextView::findLine(size_t _start, size_t _firstLine) const
+	{
+		if (_firstLine >= mLineStart.size())
+			return ITEM_NONE;
+
+		std::vector<size_t>::const_iterator line = std::lower_bound(mLineStart.begin() + _firstLine, mLineStart.end(), _start);
+		if (line == mLineStart.end() || *line != _start)
+			return ITEM_NONE;
+		return line - mLineStart.begin();
+	}
+
+	size_t TextView::getCursorPosition(const IntPoint& _value) const
 	{
 		const int height = mFontHeight;
 		size_t result = 0;
@@ -338,7 +498,7 @@ namespace MyGUI
 		return result;
 	}
 
-	IntPoint TextView::getCursorPoint(size_t _position)
+	IntPoint TextView::getCursorPoint(size_t _position) const
 	{
 		setMin(_position, mLength);
 
@@ -385,4 +545,27 @@ namespace MyGUI
 		return mLineInfo;
 	}
 
+	size_t TextView::getLinePosition(size_t _line) const
+	{
+		MYGUI_ASSERT_RANGE(_line, mLinePosition.size(), "TextView::getLinePosition");
+		return mLinePosition[_line];
+	}
+
+	const CharInfo* TextView::getLineColour(size_t _line) const
+	{
+		MYGUI_ASSERT_RANGE(_line, mColourLine.size(), "TextView::getLineColour");
+
+		size_t line = mColourLine[_line];
+		if (line == ITEM_NONE)
+			return nullptr;
+
+		const VectorCharInfo& simbols = mLineInfo[line].simbols;
+		for (VectorCharInfo::const_reverse_iterator sim = simbols.rbegin(); sim != simbols.rend(); ++sim)
+		{
+			if (sim->isColour())
+				return &(*sim);
+		}
+		return nullptr;
+	}
+
 } // namespace MyGUI
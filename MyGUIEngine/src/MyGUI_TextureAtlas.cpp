@@ -0,0 +1,213 @@
+/*
+ * This source file is part of MyGUI. For the latest info, see http://mygui.info/
+ * Distributed under the MIT License
+ * (See accompanying file COPYING.MIT or copy at http://opensource.org/licenses/MIT)
+ */
+
+#include "MyGUI_Precompiled.h"
+#include "MyGUI_TextureAtlas.h"
+#include "MyGUI_TextureUtility.h"
+#include "MyGUI_RenderManager.h"
+#include "MyGUI_StringUtility.h"
+
+namespace MyGUI
+{
+
+	// size of one atlas page in pixels
+	const int TEXTURE_ATLAS_PAGE_SIZE = 1024;
+	// only textures not bigger than this are packed
+	const int TEXTURE_ATLAS_MAX_TEXTURE_SIZE = 256;
+	// border around each texture, filled with edge pixels to avoid bleeding on filtering
+	const int TEXTURE_ATLAS_PADDING = 1;
+	const size_t TEXTURE_ATLAS_PIXEL_SIZE = 4;
+
+	TextureAtlas::TextureAtlas()
+	{
+	}
+
+	TextureAtlas::~TextureAtlas()
+	{
+	}
+
+	bool TextureAtlas::getPlacement(const std::string& _texture, std::string& _page, IntPoint& _offset)
+	{
+		if (_texture.empty())
+			return false;
+
+		MapPlacement::iterator item = mPlacements.find(_texture);
+		if (item == mPlacements.end())
+		{
+			if (mRejected.find(_texture) != mRejected.end())
+				return false;
+
+			Placement placement;
+			if (!addTexture(_texture, placement))
+			{
+				mRejected.insert(_texture);
+				return false;
+			}
+
+			item = mPlacements.insert(std::make_pair(_texture, placement)).first;
+		}
+
+		_page = mPages[item->second.page].texture->getName();
+		_offset = item->second.offset;
+		return true;
+	}
+
+	void TextureAtlas::clear()
+	{
+		RenderManager& render = RenderManager::getInstance();
+		for (VectorPage::iterator page = mPages.begin(); page != mPages.end(); ++page)
+			render.destroyTexture(page->texture);
+
+		mPages.clear();
+		mPlacements.clear();
+		mRejected.clear();
+	}
+
+	void TextureAtlas::commit()
+	{
+		for (VectorPage::iterator page = mPages.begin(); page != mPages.end(); ++page)
+		{
+			if (!page->dirty)
+				continue;
+
+			void* data = page->texture->lock(TextureUsage::Write);
+			if (data != nullptr)
+			{
+				memcpy(data, &page->data[0], page->data.size());
+				page->texture->unlock();
+			}
+			page->dirty = false;
+		}
+	}
+
+	bool TextureAtlas::addTexture(const std::string& _texture, Placement& _result)
+	{
+		RenderManager& render = RenderManager::getInstance();
+
+		// texture created by someone else may be still referenced, only texture loaded here is released after packing
+		bool loaded = render.getTexture(_texture) == nullptr;
+
+		// loads texture if needed
+		const IntSize size = texture_utility::getTextureSize(_texture, false);
+		if (size.width <= 0 || size.height <= 0 ||
+			size.width > TEXTURE_ATLAS_MAX_TEXTURE_SIZE || size.height > TEXTURE_ATLAS_MAX_TEXTURE_SIZE)
+			return false;
+
+		ITexture* texture = render.getTexture(_texture);
+		if (texture == nullptr || texture->getFormat() != PixelFormat::R8G8B8A8 || texture->getNumElemBytes() != TEXTURE_ATLAS_PIXEL_SIZE)
+			return false;
+
+		uint8* source = static_cast<uint8*>(texture->lock(TextureUsage::Read));
+		if (source == nullptr)
+			return false;
+
+		int width = size.width + TEXTURE_ATLAS_PADDING * 2;
+		int height = size.height + TEXTURE_ATLAS_PADDING * 2;
+
+		IntPoint point;
+		size_t index = mPages.size();
+		for (size_t page = 0; page < mPages.size(); ++page)
+		{
+			if (allocate(mPages[page], width, height, point))
+			{
+				index = page;
+				break;
+			}
+		}
+
+		if (index == mPages.size())
+		{
+			createPage();
+			allocate(mPages.back(), width, height, point);
+		}
+
+		copyPixels(mPages[index], source, size.width, size.height, point);
+		texture->unlock();
+
+		// only packed rectangle is uploaded, whole page is uploaded on commit if render system can't do it
+		Page& page = mPages[index];
+		if (!page.dirty && !page.texture->updateRegion(IntCoord(point.left, point.top, width, height), &page.data[0]))
+			page.dirty = true;
+
+		_result.page = index;
+		_result.offset = IntPoint(point.left + TEXTURE_ATLAS_PADDING, point.top + TEXTURE_ATLAS_PADDING);
+
+		MYGUI_LOG(Info, "Texture '" << _texture << "' packed into '" << page.texture->getName() << "' at " << _result.offset.print());
+
+		// pixels are kept in page, widgets that use texture directly load it again
+		if (loaded)
+		{
+			render.destroyTexture(texture);
+			// size cache must not refer to released texture
+			texture_utility::getTextureSize(page.texture->getName(), false);
+		}
+
+		return true;
+	}
+
+	bool TextureAtlas::allocate(Page& _page, int _width, int _height, IntPoint& _point)
+	{
+		// simple shelf packing, textures are placed in rows of current shelf height
+		int left = _page.shelfLeft;
+		int top = _page.shelfTop;
+		int height = _page.shelfHeight;
+		if (left + _width > TEXTURE_ATLAS_PAGE_SIZE)
+		{
+			top += height;
+			left = 0;
+			height = 0;
+		}
+
+		if (top + _height > TEXTURE_ATLAS_PAGE_SIZE)
+			return false;
+
+		_point.set(left, top);
+		_page.shelfLeft = left + _width;
+		_page.shelfTop = top;
+		_page.shelfHeight = (std::max)(height, _height);
+		return true;
+	}
+
+	void TextureAtlas::createPage()
+	{
+		RenderManager& render = RenderManager::getInstance();
+
+		std::string name = utility::toString("MyGUI_TextureAtlas_", mPages.size());
+		ITexture* texture = render.createTexture(name);
+		texture->createManual(TEXTURE_ATLAS_PAGE_SIZE, TEXTURE_ATLAS_PAGE_SIZE, TextureUsage::Static | TextureUsage::Write, PixelFormat::R8G8B8A8);
+
+		Page page;
+		page.texture = texture;
+		page.data.resize(TEXTURE_ATLAS_PAGE_SIZE * TEXTURE_ATLAS_PAGE_SIZE * TEXTURE_ATLAS_PIXEL_SIZE, 0);
+		page.shelfLeft = 0;
+		page.shelfTop = 0;
+		page.shelfHeight = 0;
+		// content of new texture is undefined, it is uploaded whole once
+		page.dirty = true;
+		mPages.push_back(page);
+	}
+
+	void TextureAtlas::copyPixels(Page& _page, const uint8* _source, int _width, int _height, const IntPoint& _point)
+	{
+		int padded_width = _width + TEXTURE_ATLAS_PADDING * 2;
+		int padded_height = _height + TEXTURE_ATLAS_PADDING * 2;
+
+		for (int y = 0; y < padded_height; ++y)
+		{
+			// padding repeats nearest edge pixel
+			int source_y = (std::min)((std::max)(y - TEXTURE_ATLAS_PADDING, 0), _height - 1);
+			const uint8* source_row = _source + source_y * _width * TEXTURE_ATLAS_PIXEL_SIZE;
+			uint8* dest_row = &_page.data[((_point.top + y) * TEXTURE_ATLAS_PAGE_SIZE + _point.left) * TEXTURE_ATLAS_PIXEL_SIZE];
+
+			for (int x = 0; x < padded_width; ++x)
+			{
+				int source_x = (std::min)((std::max)(x - TEXTURE_ATLAS_PADDING, 0), _width - 1);
+				memcpy(dest_row + x * TEXTURE_ATLAS_PIXEL_SIZE, source_row + source_x * TEXTURE_ATLAS_PIXEL_SIZE, TEXTURE_ATLAS_PIXEL_SIZE);
+			}
+		}
+	}
+
+} // namespace MyGUI
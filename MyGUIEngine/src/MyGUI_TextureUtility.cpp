@@ -10,6 +10,7 @@
 #include "MyGUI_DataManager.h"
 #include "MyGUI_Bitwise.h"
 #include "MyGUI_Constants.h"
+#include "MyGUI_CoordConverter.h"
 
 namespace MyGUI
 {
@@ -65,6 +66,16 @@ namespace MyGUI
 			return prevSize;
 		}
 
+		FloatRect getTextureRect(const std::string& _texture, const IntCoord& _coord)
+		{
+			std::string page;
+			IntPoint offset;
+			if (RenderManager::getInstance()._getTextureAtlasPlacement(_texture, page, offset))
+				return CoordConverter::convertTextureCoord(_coord + offset, getTextureSize(page));
+
+			return CoordConverter::convertTextureCoord(_coord, getTextureSize(_texture));
+		}
+
 		uint32 toColourARGB(const Colour& _colour)
 		{
 			uint32 val32 = uint8(_colour.alpha * 255);
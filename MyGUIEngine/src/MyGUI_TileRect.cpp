@@ -46,7 +46,7 @@ namespace MyGUI
 		mVisible = _visible;
 
 		if (nullptr != mNode)
-			mNode->outOfDate(mRenderItem);
+			mNode->outOfDate(mRenderItem, this);
 	}
 
 	void TileRect::setAlpha(float _alpha)
@@ -55,13 +55,13 @@ namespace MyGUI
 		mCurrentColour = (mCurrentColour & 0x00FFFFFF) | (alpha & 0xFF000000);
 
 		if (nullptr != mNode)
-			mNode->outOfDate(mRenderItem);
+			mNode->outOfDate(mRenderItem, this);
 	}
 
 	void TileRect::_correctView()
 	{
 		if (nullptr != mNode)
-			mNode->outOfDate(mRenderItem);
+			mNode->outOfDate(mRenderItem, this);
 	}
 
 	void TileRect::_setAlign(const IntSize& _oldsize)
@@ -167,7 +167,7 @@ namespace MyGUI
 
 				// обновить перед выходом
 				if (nullptr != mNode)
-					mNode->outOfDate(mRenderItem);
+					mNode->outOfDate(mRenderItem, this);
 				return;
 			}
 		}
@@ -176,14 +176,14 @@ namespace MyGUI
 		mIsMargin = margin;
 
 		if (nullptr != mNode)
-			mNode->outOfDate(mRenderItem);
+			mNode->outOfDate(mRenderItem, this);
 	}
 
 	void TileRect::_setUVSet(const FloatRect& _rect)
 	{
 		mCurrentTexture = _rect;
 		if (nullptr != mNode)
-			mNode->outOfDate(mRenderItem);
+			mNode->outOfDate(mRenderItem, this);
 	}
 
 	void TileRect::doRender()
@@ -366,7 +366,7 @@ namespace MyGUI
 		mCurrentColour = (colour & 0x00FFFFFF) | (mCurrentColour & 0xFF000000);
 
 		if (nullptr != mNode)
-			mNode->outOfDate(mRenderItem);
+			mNode->outOfDate(mRenderItem, this);
 	}
 
 } // namespace MyGUI
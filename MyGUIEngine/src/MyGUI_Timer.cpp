@@ -54,4 +54,19 @@ namespace MyGUI
 #endif
 	}
 
+	unsigned long Timer::getCurrentMicroseconds()
+	{
+#if MYGUI_COMPILER == MYGUI_COMPILER_MSVC
+		LARGE_INTEGER frequency;
+		LARGE_INTEGER counter;
+		QueryPerformanceFrequency(&frequency);
+		QueryPerformanceCounter(&counter);
+		return (unsigned long)((counter.QuadPart / frequency.QuadPart) * 1000000 + (counter.QuadPart % frequency.QuadPart) * 1000000 / frequency.QuadPart);
+#else
+		struct timeval now;
+		gettimeofday(&now, NULL);
+		return (now.tv_sec) * 1000000 + now.tv_usec;
+#endif
+	}
+
 } // namespace MyGUI
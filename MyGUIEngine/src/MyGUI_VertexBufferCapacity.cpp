@@ -0,0 +1,83 @@
+/*
+ * This source file is part of MyGUI. For the latest info, see http://mygui.info/
+ * Distributed under the MIT License
+ * (See accompanying file COPYING.MIT or copy at http://opensource.org/licenses/MIT)
+ */
+
+#include "MyGUI_Precompiled.h"
+#include "MyGUI_VertexBufferCapacity.h"
+#include "MyGUI_RenderManager.h"
+#include "MyGUI_VertexData.h"
+
+namespace MyGUI
+{
+
+	// minimal capacity, enough for several quads
+	const size_t VERTEX_BUFFER_MIN_CAPACITY = 5 * VertexQuad::VertexCount;
+	// buffer is shrunk when it's capacity is this times bigger than needed...
+	const size_t VERTEX_BUFFER_SHRINK_RATIO = 4;
+	// ...for this number of frames
+	const size_t VERTEX_BUFFER_SHRINK_FRAMES = 120;
+
+	VertexBufferCapacity::VertexBufferCapacity() :
+		mCapacity(0),
+		mOversized(false),
+		mOversizedFrame(0)
+	{
+	}
+
+	bool VertexBufferCapacity::update(size_t _count)
+	{
+		RenderManager& render = RenderManager::getInstance();
+
+		if (_count > mCapacity || mCapacity == 0)
+		{
+			mCapacity = (std::max)((std::max)(_count, mCapacity * 2), VERTEX_BUFFER_MIN_CAPACITY);
+			mOversized = false;
+
+			render._notifyVertexBufferReallocated();
+			return true;
+		}
+
+		if (checkShrink(_count))
+		{
+			// leave some space to grow back without reallocation
+			mCapacity = (std::max)(_count * 2, VERTEX_BUFFER_MIN_CAPACITY);
+			mOversized = false;
+
+			render._notifyVertexBufferReallocated();
+			return true;
+		}
+
+		return false;
+	}
+
+	bool VertexBufferCapacity::checkShrink(size_t _count)
+	{
+		if (mCapacity > VERTEX_BUFFER_MIN_CAPACITY && _count * VERTEX_BUFFER_SHRINK_RATIO < mCapacity)
+		{
+			size_t frame = RenderManager::getInstance()._getFrameNumber();
+			if (!mOversized)
+			{
+				mOversized = true;
+				mOversizedFrame = frame;
+			}
+			return frame - mOversizedFrame >= VERTEX_BUFFER_SHRINK_FRAMES;
+		}
+
+		mOversized = false;
+		return false;
+	}
+
+	size_t VertexBufferCapacity::getCapacity() const
+	{
+		return mCapacity;
+	}
+
+	void VertexBufferCapacity::reset()
+	{
+		mCapacity = 0;
+		mOversized = false;
+	}
+
+} // namespace MyGUI
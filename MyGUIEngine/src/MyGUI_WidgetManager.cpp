@@ -9,6 +9,7 @@
 #include "MyGUI_Gui.h"
 #include "MyGUI_Widget.h"
 #include "MyGUI_FactoryManager.h"
+#include "MyGUI_RenderManager.h"
 
 #include "MyGUI_Button.h"
 #include "MyGUI_Canvas.h"
@@ -109,6 +110,10 @@ namespace MyGUI
 			Widget* widget = object->castType<Widget>();
 			widget->_initialise(_style, _coord, _skin, _parent, _cropeedParent, _name);
 
+			RenderManager* render = RenderManager::getInstancePtr();
+			if (render != nullptr)
+				++render->_getFrameStatistics().widgetsCreated;
+
 			return widget;
 		}
 
@@ -178,6 +183,10 @@ namespace MyGUI
 		}
 
 		mDestroyWidgets.push_back(_widget);
+
+		RenderManager* render = RenderManager::getInstancePtr();
+		if (render != nullptr)
+			++render->_getFrameStatistics().widgetsDestroyed;
 	}
 
 	void WidgetManager::_deleteDelayWidgets()
@@ -7,6 +7,8 @@
 #include "MyGUI_Precompiled.h"
 #include "MyGUI_XmlDocument.h"
 #include "MyGUI_DataManager.h"
+#include <deque>
+#include <map>
 
 namespace MyGUI
 {
@@ -15,47 +17,92 @@ namespace MyGUI
 
 		namespace utility
 		{
-			static std::string convert_from_xml(const std::string& _string, bool& _ok)
+			static bool is_space(char _char)
 			{
-				std::string ret;
-				_ok = true;
+				return _char == ' ' || _char == '\t' || _char == '\r' || _char == '\n';
+			}
 
-				size_t pos = _string.find("&");
-				if (pos == std::string::npos) return _string;
+			static void trim(const char*& _begin, const char*& _end)
+			{
+				while (_begin != _end && is_space(*_begin))
+					++_begin;
+				while (_end != _begin && is_space(*(_end - 1)))
+					--_end;
+			}
 
-				ret.reserve(_string.size());
-				size_t old = 0;
-				while (pos != std::string::npos)
+			// ищет символ без учета ковычек
+			static const char* find(const char* _begin, const char* _end, char _char)
+			{
+				bool quote = false;
+				for (; _begin != _end; ++_begin)
 				{
-					ret += _string.substr(old, pos - old);
+					if (*_begin == '"')
+						quote = !quote;
+					else if (!quote && *_begin == _char)
+						break;
+				}
+				return _begin;
+			}
 
-					size_t end = _string.find(";", pos + 1);
-					if (end == std::string::npos)
-					{
-						_ok = false;
-						return ret;
-					}
-					else
+			// копирует текст без переводов строк и заменяет сущности
+			static bool convert_from_xml(const char* _begin, const char* _end, std::string& _result)
+			{
+				_result.clear();
+				_result.reserve(_end - _begin);
+
+				const char* copy = _begin;
+				for (const char* iter = _begin; iter != _end; ++iter)
+				{
+					if (*iter != '\n')
+						continue;
+					const char* line_end = iter;
+					if (line_end != copy && *(line_end - 1) == '\r')
+						--line_end;
+					_result.append(copy, line_end);
+					copy = iter + 1;
+				}
+				_result.append(copy, _end);
+
+				size_t pos = _result.find('&');
+				if (pos == std::string::npos)
+					return true;
+
+				size_t size = pos;
+				while (pos < _result.size())
+				{
+					if (_result[pos] != '&')
 					{
-						std::string tag = _string.substr(pos, end - pos + 1);
-						if (tag == "&amp;") ret += '&';
-						else if (tag == "&lt;") ret += '<';
-						else if (tag == "&gt;") ret += '>';
-						else if (tag == "&apos;") ret += '\'';
-						else if (tag == "&quot;") ret += '\"';
-						else
-						{
-							_ok = false;
-							return ret;
-						}
+						_result[size ++] = _result[pos ++];
+						continue;
 					}
 
-					old = end + 1;
-					pos = _string.find("&", old);
+					size_t end = _result.find(';', pos + 1);
+					if (end == std::string::npos)
+						return false;
+
+					size_t length = end - pos + 1;
+					if (_result.compare(pos, length, "&amp;") == 0) _result[size ++] = '&';
+					else if (_result.compare(pos, length, "&lt;") == 0) _result[size ++] = '<';
+					else if (_result.compare(pos, length, "&gt;") == 0) _result[size ++] = '>';
+					else if (_result.compare(pos, length, "&apos;") == 0) _result[size ++] = '\'';
+					else if (_result.compare(pos, length, "&quot;") == 0) _result[size ++] = '\"';
+					else return false;
+
+					pos = end + 1;
 				}
-				ret += _string.substr(old, std::string::npos);
+				_result.resize(size);
 
-				return ret;
+				return true;
+			}
+
+			// заголовок документа сохраненного saveBinary
+			static const char binary_magic[] = "MYGUIBIN";
+			static const size_t binary_magic_size = sizeof(binary_magic) - 1;
+			static const size_t binary_version = 1;
+
+			static bool is_binary(const std::string& _buffer)
+			{
+				return _buffer.compare(0, binary_magic_size, binary_magic) == 0;
 			}
 
 			static std::string convert_to_xml(const std::string& _string)
@@ -87,6 +134,386 @@ namespace MyGUI
 
 		}
 
+		//----------------------------------------------------------------------//
+		// class ElementArena
+		//----------------------------------------------------------------------//
+		struct ArenaAttribute
+		{
+			const std::string* key;
+			const char* value;
+			size_t size;
+		};
+
+		class ElementArena
+		{
+		public:
+			ElementArena() :
+				mCurrent(nullptr),
+				mFree(0),
+				mAtomTable(64, nullptr)
+			{
+			}
+
+			~ElementArena()
+			{
+				for (std::vector<char*>::iterator item = mBlocks.begin(); item != mBlocks.end(); ++item)
+					delete[] *item;
+			}
+
+			ElementPtr createElement(const char* _begin, const char* _end, ElementPtr _parent, ElementType _type)
+			{
+				return createElement(getAtom(_begin, _end), _parent, _type);
+			}
+
+			ElementPtr createElement(const std::string* _name, ElementPtr _parent, ElementType _type)
+			{
+				return new (allocate(sizeof(Element))) Element(_name, _parent, _type, this);
+			}
+
+			// значение уже готово и живет не меньше арены, не копируем
+			void addAttribute(const std::string* _key, const char* _value, size_t _size)
+			{
+				ArenaAttribute attribute;
+				attribute.key = _key;
+				attribute.value = _value;
+				attribute.size = _size;
+				mAttributes.push_back(attribute);
+			}
+
+			// атрибуты тега собираются по одному, потом переносятся в узел
+			bool addAttribute(const char* _key, const char* _keyEnd, const char* _value, const char* _valueEnd)
+			{
+				ArenaAttribute attribute;
+				attribute.key = getAtom(_key, _keyEnd);
+
+				if (!utility::convert_from_xml(_value, _valueEnd, mValue))
+					return false;
+
+				attribute.size = mValue.size();
+				char* value = static_cast<char*>(allocate(attribute.size));
+				mValue.copy(value, attribute.size);
+				attribute.value = value;
+				mAttributes.push_back(attribute);
+				return true;
+			}
+
+			void setAttributes(ElementPtr _element)
+			{
+				if (!mAttributes.empty())
+				{
+					ArenaAttribute* attributes = static_cast<ArenaAttribute*>(allocate(sizeof(ArenaAttribute) * mAttributes.size()));
+					std::copy(mAttributes.begin(), mAttributes.end(), attributes);
+					_element->mArenaAttributes = attributes;
+					_element->mArenaAttributesCount = mAttributes.size();
+				}
+				mAttributes.clear();
+			}
+
+			// забирает буфер документа, значения атрибутов указывают в него
+			const std::string& setBuffer(std::string& _buffer)
+			{
+				mBuffer.swap(_buffer);
+				return mBuffer;
+			}
+
+			// имена хранятся один раз, таблица с открытой адресацией
+			const std::string* getAtom(const char* _begin, const char* _end)
+			{
+				size_t size = _end - _begin;
+				size_t mask = mAtomTable.size() - 1;
+				for (size_t index = getHash(_begin, _end) & mask; ; index = (index + 1) & mask)
+				{
+					const std::string* atom = mAtomTable[index];
+					if (atom == nullptr)
+						break;
+					if (atom->size() == size && atom->compare(0, size, _begin, size) == 0)
+						return atom;
+				}
+
+				mAtoms.push_back(std::string(_begin, _end));
+				const std::string* atom = &mAtoms.back();
+
+				// заполнена наполовину, увеличиваем
+				if (mAtoms.size() * 2 > mAtomTable.size())
+				{
+					std::vector<const std::string*> table(mAtomTable.size() * 2, nullptr);
+					mAtomTable.swap(table);
+					for (std::deque<std::string>::const_iterator item = mAtoms.begin(); item != mAtoms.end(); ++item)
+						insertAtom(&*item);
+				}
+				else
+				{
+					insertAtom(atom);
+				}
+
+				return atom;
+			}
+
+		private:
+			void insertAtom(const std::string* _atom)
+			{
+				size_t mask = mAtomTable.size() - 1;
+				size_t index = getHash(_atom->data(), _atom->data() + _atom->size()) & mask;
+				while (mAtomTable[index] != nullptr)
+					index = (index + 1) & mask;
+				mAtomTable[index] = _atom;
+			}
+
+			static size_t getHash(const char* _begin, const char* _end)
+			{
+				// FNV-1a
+				size_t hash = 2166136261U;
+				for (; _begin != _end; ++_begin)
+					hash = (hash ^ (unsigned char)*_begin) * 16777619U;
+				return hash;
+			}
+
+			void* allocate(size_t _size)
+			{
+				const size_t alignment = 16;
+				const size_t blockSize = 64 * 1024;
+
+				_size = (_size + alignment - 1) & ~(alignment - 1);
+				if (_size > mFree)
+				{
+					// большие куски отдельным блоком, чтобы не терять остаток текущего
+					if (_size > blockSize / 4)
+					{
+						char* block = new char[_size];
+						mBlocks.push_back(block);
+						return block;
+					}
+
+					mCurrent = new char[blockSize];
+					mBlocks.push_back(mCurrent);
+					mFree = blockSize;
+				}
+
+				void* result = mCurrent;
+				mCurrent += _size;
+				mFree -= _size;
+				return result;
+			}
+
+		private:
+			std::vector<char*> mBlocks;
+			char* mCurrent;
+			size_t mFree;
+
+			std::deque<std::string> mAtoms;
+			std::vector<const std::string*> mAtomTable;
+			std::vector<ArenaAttribute> mAttributes;
+			// буфер для значений
+			std::string mValue;
+			// двоичный документ, на который ссылаются значения
+			std::string mBuffer;
+		};
+
+		//----------------------------------------------------------------------//
+		// class BinaryReader
+		//----------------------------------------------------------------------//
+		class BinaryReader
+		{
+		public:
+			BinaryReader(const char* _begin, const char* _end) :
+				mPosition(_begin),
+				mEnd(_end),
+				mFail(false)
+			{
+			}
+
+			bool readHeader()
+			{
+				if ((size_t)(mEnd - mPosition) < utility::binary_magic_size)
+					return false;
+				mPosition += utility::binary_magic_size;
+
+				if (readNumber() != utility::binary_version)
+					return false;
+
+				size_t count = readNumber();
+				// каждая строка занимает хотя бы байт длины
+				if (count > (size_t)(mEnd - mPosition))
+					return false;
+
+				mStrings.resize(count);
+				for (size_t index = 0; index < count; ++index)
+				{
+					size_t size = readNumber();
+					if (mFail || size > (size_t)(mEnd - mPosition))
+						return false;
+					mStrings[index].data = mPosition;
+					mStrings[index].size = size;
+					mStrings[index].atom = nullptr;
+					mPosition += size;
+				}
+
+				return !mFail;
+			}
+
+			size_t readNumber()
+			{
+				// по семь бит, старший бит байта означает продолжение
+				size_t result = 0;
+				for (size_t shift = 0; shift < sizeof(size_t) * 8; shift += 7)
+				{
+					if (mPosition == mEnd)
+						break;
+					unsigned char value = (unsigned char)*mPosition++;
+					result |= (size_t)(value & 0x7F) << shift;
+					if ((value & 0x80) == 0)
+						return result;
+				}
+
+				mFail = true;
+				mPosition = mEnd;
+				return 0;
+			}
+
+			// индекс строки из таблицы, или -1 если индекс неверный
+			size_t readString()
+			{
+				size_t index = readNumber();
+				if (index < mStrings.size())
+					return index;
+
+				mFail = true;
+				return (size_t)-1;
+			}
+
+			const char* getData(size_t _index) const
+			{
+				return mStrings[_index].data;
+			}
+
+			size_t getSize(size_t _index) const
+			{
+				return mStrings[_index].size;
+			}
+
+			const std::string* getAtom(size_t _index, ElementArena* _arena)
+			{
+				StringInfo& info = mStrings[_index];
+				if (info.atom == nullptr)
+					info.atom = _arena->getAtom(info.data, info.data + info.size);
+				return info.atom;
+			}
+
+			void setFail()
+			{
+				mFail = true;
+			}
+
+			bool isFail() const
+			{
+				return mFail;
+			}
+
+			bool isEnd() const
+			{
+				return mPosition == mEnd;
+			}
+
+		private:
+			struct StringInfo
+			{
+				const char* data;
+				size_t size;
+				const std::string* atom;
+			};
+
+			const char* mPosition;
+			const char* mEnd;
+			bool mFail;
+			std::vector<StringInfo> mStrings;
+		};
+
+		//----------------------------------------------------------------------//
+		// class BinaryWriter
+		//----------------------------------------------------------------------//
+		class BinaryWriter
+		{
+		public:
+			// собирает все строки узла и его детей в таблицу
+			void addStrings(ElementPtr _element)
+			{
+				addString(_element->getName());
+				addString(_element->getContent());
+
+				const VectorAttributes& attributes = _element->getAttributes();
+				for (VectorAttributes::const_iterator item = attributes.begin(); item != attributes.end(); ++item)
+				{
+					addString(item->first);
+					addString(item->second);
+				}
+
+				ElementEnumerator child = _element->getElementEnumerator();
+				while (child.next())
+					addStrings(child.current());
+			}
+
+			void writeHeader(std::ostream& _stream)
+			{
+				_stream.write(utility::binary_magic, utility::binary_magic_size);
+				writeNumber(_stream, utility::binary_version);
+
+				writeNumber(_stream, mStrings.size());
+				for (std::vector<const std::string*>::const_iterator item = mStrings.begin(); item != mStrings.end(); ++item)
+				{
+					writeNumber(_stream, (*item)->size());
+					_stream.write((*item)->data(), (*item)->size());
+				}
+			}
+
+			void writeElement(std::ostream& _stream, ElementPtr _element)
+			{
+				writeNumber(_stream, _element->getType().getValue());
+				writeNumber(_stream, mIndices[_element->getName()]);
+				writeNumber(_stream, mIndices[_element->getContent()]);
+
+				const VectorAttributes& attributes = _element->getAttributes();
+				writeNumber(_stream, attributes.size());
+				for (VectorAttributes::const_iterator item = attributes.begin(); item != attributes.end(); ++item)
+				{
+					writeNumber(_stream, mIndices[item->first]);
+					writeNumber(_stream, mIndices[item->second]);
+				}
+
+				size_t count = 0;
+				ElementEnumerator child = _element->getElementEnumerator();
+				while (child.next())
+					count ++;
+				writeNumber(_stream, count);
+
+				child = _element->getElementEnumerator();
+				while (child.next())
+					writeElement(_stream, child.current());
+			}
+
+			static void writeNumber(std::ostream& _stream, size_t _value)
+			{
+				while (_value >= 0x80)
+				{
+					_stream.put((char)((_value & 0x7F) | 0x80));
+					_value >>= 7;
+				}
+				_stream.put((char)_value);
+			}
+
+		private:
+			void addString(const std::string& _value)
+			{
+				std::pair<MapIndex::iterator, bool> result = mIndices.insert(MapIndex::value_type(_value, mStrings.size()));
+				if (result.second)
+					mStrings.push_back(&result.first->first);
+			}
+
+		private:
+			typedef std::map<std::string, size_t> MapIndex;
+			MapIndex mIndices;
+			std::vector<const std::string*> mStrings;
+		};
+
 		//----------------------------------------------------------------------//
 		// class ElementEnumerator
 		//----------------------------------------------------------------------//
@@ -141,7 +568,21 @@ namespace MyGUI
 			mName(_name),
 			mContent(_content),
 			mParent(_parent),
-			mType(_type)
+			mType(_type),
+			mArena(nullptr),
+			mArenaName(nullptr),
+			mArenaAttributes(nullptr),
+			mArenaAttributesCount(0)
+		{
+		}
+
+		Element::Element(const std::string* _name, ElementPtr _parent, ElementType _type, ElementArena* _arena) :
+			mParent(_parent),
+			mType(_type),
+			mArena(_arena),
+			mArenaName(_name),
+			mArenaAttributes(nullptr),
+			mArenaAttributesCount(0)
 		{
 		}
 
@@ -149,11 +590,35 @@ namespace MyGUI
 		{
 			for (VectorElement::iterator iter = mChilds.begin(); iter != mChilds.end(); ++iter)
 			{
-				delete *iter;
+				destroy(*iter);
 			}
 			mChilds.clear();
 		}
 
+		void Element::destroy(ElementPtr _element)
+		{
+			if (_element->mArena != nullptr)
+				_element->~Element();
+			else
+				delete _element;
+		}
+
+		void Element::prepareAttributes() const
+		{
+			if (mArenaAttributesCount == 0)
+				return;
+
+			mAttributes.reserve(mAttributes.size() + mArenaAttributesCount);
+			for (size_t index = 0; index < mArenaAttributesCount; ++index)
+			{
+				const ArenaAttribute& attribute = mArenaAttributes[index];
+				mAttributes.push_back(PairAttribute(*attribute.key, std::string(attribute.value, attribute.size)));
+			}
+
+			mArenaAttributes = nullptr;
+			mArenaAttributesCount = 0;
+		}
+
 		void Element::save(std::ostream& _stream, size_t _level)
 		{
 			// сначала табуляции намутим
@@ -168,8 +633,9 @@ namespace MyGUI
 			else
 				_stream << "<";
 
-			_stream << mName;
+			_stream << getName();
 
+			prepareAttributes();
 			for (VectorAttributes::iterator iter = mAttributes.begin(); iter != mAttributes.end(); ++iter)
 			{
 				_stream << " " << iter->first << "=\"" << utility::convert_to_xml(iter->second) << "\"";
@@ -214,13 +680,22 @@ namespace MyGUI
 					for (size_t tab = 0; tab < _level; ++tab)
 						_stream  << "    ";
 				}
-				_stream << "</" << mName << ">\n";
+				_stream << "</" << getName() << ">\n";
 			}
 		}
 
 		ElementPtr Element::createChild(const std::string& _name, const std::string& _content, ElementType _type)
 		{
-			ElementPtr node = new Element(_name, this, _type, _content);
+			ElementPtr node = nullptr;
+			if (mArena != nullptr)
+			{
+				node = mArena->createElement(_name.data(), _name.data() + _name.size(), this, _type);
+				node->mContent = _content;
+			}
+			else
+			{
+				node = new Element(_name, this, _type, _content);
+			}
 			mChilds.push_back(node);
 			return node;
 		}
@@ -230,21 +705,33 @@ namespace MyGUI
 			VectorElement::iterator item = std::find(mChilds.begin(), mChilds.end(), _child);
 			if (item != mChilds.end())
 			{
-				delete (*item);
+				destroy(*item);
 				mChilds.erase(item);
 			}
 		}
 
 		void Element::clear()
 		{
-			for (VectorElement::iterator iter = mChilds.begin(); iter != mChilds.end(); ++iter) delete *iter;
+			for (VectorElement::iterator iter = mChilds.begin(); iter != mChilds.end(); ++iter) destroy(*iter);
 			mChilds.clear();
 			mContent.clear();
 			mAttributes.clear();
+			mArenaAttributes = nullptr;
+			mArenaAttributesCount = 0;
 		}
 
 		bool Element::findAttribute(const std::string& _name, std::string& _value)
 		{
+			for (size_t index = 0; index < mArenaAttributesCount; ++index)
+			{
+				const ArenaAttribute& attribute = mArenaAttributes[index];
+				if (*attribute.key == _name)
+				{
+					_value.assign(attribute.value, attribute.size);
+					return true;
+				}
+			}
+
 			for (VectorAttributes::iterator iter = mAttributes.begin(); iter != mAttributes.end(); ++iter)
 			{
 				if ( (*iter).first == _name)
@@ -258,6 +745,13 @@ namespace MyGUI
 
 		std::string Element::findAttribute(const std::string& _name)
 		{
+			for (size_t index = 0; index < mArenaAttributesCount; ++index)
+			{
+				const ArenaAttribute& attribute = mArenaAttributes[index];
+				if (*attribute.key == _name)
+					return std::string(attribute.value, attribute.size);
+			}
+
 			for (VectorAttributes::iterator iter = mAttributes.begin(); iter != mAttributes.end(); ++iter)
 			{
 				if ((*iter).first == _name)
@@ -268,11 +762,13 @@ namespace MyGUI
 
 		void Element::addAttribute(const std::string& _key, const std::string& _value)
 		{
+			prepareAttributes();
 			mAttributes.push_back(PairAttribute(_key, _value));
 		}
 
 		void Element::removeAttribute(const std::string& _key)
 		{
+			prepareAttributes();
 			for (size_t index = 0; index < mAttributes.size(); ++index)
 			{
 				if (mAttributes[index].first == _key)
@@ -285,7 +781,8 @@ namespace MyGUI
 
 		ElementPtr Element::createCopy()
 		{
-			Element* elem = new Element(mName, nullptr, mType, mContent);
+			prepareAttributes();
+			Element* elem = new Element(getName(), nullptr, mType, mContent);
 			elem->mAttributes = mAttributes;
 
 			for (VectorElement::iterator iter = mChilds.begin(); iter != mChilds.end(); ++iter)
@@ -300,6 +797,7 @@ namespace MyGUI
 
 		void Element::setAttribute(const std::string& _key, const std::string& _value)
 		{
+			prepareAttributes();
 			for (size_t index = 0; index < mAttributes.size(); ++index)
 			{
 				if (mAttributes[index].first == _key)
@@ -331,7 +829,7 @@ namespace MyGUI
 
 		const std::string& Element::getName() const
 		{
-			return mName;
+			return mArenaName != nullptr ? *mArenaName : mName;
 		}
 
 		const std::string& Element::getContent() const
@@ -341,6 +839,7 @@ namespace MyGUI
 
 		const VectorAttributes& Element::getAttributes() const
 		{
+			prepareAttributes();
 			return mAttributes;
 		}
 
@@ -366,7 +865,7 @@ namespace MyGUI
 		}
 		inline void open_stream(std::ifstream& _stream, const std::wstring& _wide)
 		{
-			_stream.open(_wide.c_str());
+			_stream.open(_wide.c_str(), std::ios_base::in | std::ios_base::binary);
 		}
 #else
 		inline void open_stream(std::ofstream& _stream, const std::wstring& _wide)
@@ -375,7 +874,7 @@ namespace MyGUI
 		}
 		inline void open_stream(std::ifstream& _stream, const std::wstring& _wide)
 		{
-			_stream.open(UString(_wide).asUTF8_c_str());
+			_stream.open(UString(_wide).asUTF8_c_str(), std::ios_base::in | std::ios_base::binary);
 		}
 #endif
 
@@ -387,7 +886,9 @@ namespace MyGUI
 			mDeclaration(0),
 			mLastErrorFile(""),
 			mLine(0),
-			mCol(0)
+			mCol(0),
+			mArenaAllocation(false),
+			mArena(nullptr)
 		{
 		}
 
@@ -400,7 +901,7 @@ namespace MyGUI
 		bool Document::open(const std::string& _filename)
 		{
 			std::ifstream stream;
-			stream.open(_filename.c_str());
+			stream.open(_filename.c_str(), std::ios_base::in | std::ios_base::binary);
 
 			if (!stream.is_open())
 			{
@@ -497,45 +998,33 @@ namespace MyGUI
 		{
 			clear();
 
-			// это текущая строка для разбора
-			std::string line;
-			// это строка из файла
-			std::string read;
-			// текущий узел для разбора
-			ElementPtr currentNode = 0;
+			if (mArenaAllocation)
+				mArena = new ElementArena();
 
-			while (!_stream->eof())
+			// читаем весь поток в один буфер
+			std::string buffer;
+			size_t size = _stream->size();
+			if (size != 0 && size != (size_t)-1)
 			{
-				// берем новую строку
-				_stream->readline(read, '\n');
-				if (read.empty())
-					continue;
-				if (read[read.size() - 1] == '\r')
-					read.erase(read.size() - 1, 1);
-				if (read.empty())
-					continue;
-
-				mLine ++;
-				mCol = 0; // потом проверить на многострочных тэгах
-				if (read.empty())
-					continue;
-				// текущая строка для разбора и то что еще прочитали
-				line += read;
-
-				if (!parseLine(line, currentNode))
+				buffer.resize(size);
+				buffer.resize(_stream->read(&buffer[0], size));
+			}
+			else
+			{
+				// размер неизвестен, читаем построчно
+				std::string read;
+				while (!_stream->eof())
 				{
-					return false;
+					_stream->readline(read, '\n');
+					buffer += read;
+					buffer += '\n';
 				}
-
-			} // while (!stream.eof())
-
-			if (currentNode)
-			{
-				mLastError = ErrorType::NotClosedElements;
-				return false;
 			}
 
-			return true;
+			if (utility::is_binary(buffer))
+				return parseBinary(buffer);
+
+			return parse(buffer.data(), buffer.data() + buffer.size());
 		}
 
 		bool Document::save(std::ostream& _stream)
@@ -558,285 +1047,423 @@ namespace MyGUI
 			return true;
 		}
 
+		bool Document::saveBinary(std::ostream& _stream)
+		{
+			if (!mDeclaration)
+			{
+				mLastError = ErrorType::NoXMLDeclaration;
+				return false;
+			}
+
+			BinaryWriter writer;
+			writer.addStrings(mDeclaration);
+			if (mRoot)
+				writer.addStrings(mRoot);
+
+			// первый бит декларация, второй рутовый узел
+			writer.writeHeader(_stream);
+			BinaryWriter::writeNumber(_stream, mRoot ? 3 : 1);
+			writer.writeElement(_stream, mDeclaration);
+			if (mRoot)
+				writer.writeElement(_stream, mRoot);
+
+			return true;
+		}
+
+		bool Document::saveBinary(const std::string& _filename)
+		{
+			std::ofstream stream;
+			stream.open(_filename.c_str(), std::ios_base::out | std::ios_base::binary);
+
+			if (!stream.is_open())
+			{
+				mLastError = ErrorType::CreateFileFail;
+				setLastFileError(_filename);
+				return false;
+			}
+
+			bool result = saveBinary(stream);
+
+			if (!result)
+			{
+				setLastFileError(_filename);
+			}
+
+			stream.close();
+			return result;
+		}
+
 		void Document::clear()
 		{
 			clearDeclaration();
 			clearRoot();
 			mLine = 0;
 			mCol = 0;
+
+			// все узлы из арены уже удалены
+			delete mArena;
+			mArena = nullptr;
 		}
 
-		bool Document::parseTag(ElementPtr& _currentNode, std::string _content)
+		bool Document::parse(const char* _begin, const char* _end)
 		{
-			// убераем лишнее
-			MyGUI::utility::trim(_content);
+			// текущий узел для разбора
+			ElementPtr currentNode = nullptr;
+			// начало еще не разобранного текста
+			const char* position = _begin;
 
-			if (_content.empty())
+			// крутимся пока в тексте есть теги
+			while (true)
 			{
-				// создаем пустой тег
-				if (_currentNode)
+				// сначала ищем по угловым скобкам
+				const char* start = utility::find(position, _end, '<');
+				if (start == _end)
+					break;
+				const char* end = _end;
+
+				// пытаемся вырезать многострочный коментарий
+				if ((_end - start > 3) && (start[1] == '!') && (start[2] == '-') && (start[3] == '-'))
 				{
-					_currentNode = _currentNode->createChild("");
+					const char* close = "-->";
+					end = std::search(start + 4, _end, close, close + 3);
+					if (end == _end)
+						break;
+					end += 2;
 				}
 				else
 				{
-					_currentNode = new Element("", 0);
-					// если это первый то запоминаем
-					if (!mRoot)
-						mRoot = _currentNode;
+					end = utility::find(start + 1, _end, '>');
+					if (end == _end)
+						break;
+				}
+
+				// проверяем на наличее тела
+				if (currentNode != nullptr)
+				{
+					const char* body = position;
+					while (body != start && (utility::is_space(*body) || *body == '<'))
+						++body;
+
+					if (body != start && !utility::convert_from_xml(position, start, currentNode->mContent))
+					{
+						mLastError = ErrorType::IncorrectContent;
+						setLastErrorPosition(_begin, position);
+						return false;
+					}
+				}
+
+				// вырезаем наш тэг и парсим
+				if (!parseTag(currentNode, start + 1, end))
+				{
+					setLastErrorPosition(_begin, start);
+					return false;
 				}
+
+				position = end + 1;
+			}
+
+			if (currentNode)
+			{
+				mLastError = ErrorType::NotClosedElements;
+				setLastErrorPosition(_begin, _end);
+				return false;
+			}
+
+			return true;
+		}
+
+		bool Document::parseBinary(std::string& _buffer)
+		{
+			// в арене значения атрибутов берутся прямо из буфера
+			const std::string& buffer = mArena != nullptr ? mArena->setBuffer(_buffer) : _buffer;
+			BinaryReader reader(buffer.data(), buffer.data() + buffer.size());
+
+			if (reader.readHeader())
+			{
+				size_t flags = reader.readNumber();
+				if ((flags & 1) != 0)
+					mDeclaration = parseBinaryElement(reader, nullptr);
+				if ((flags & 2) != 0 && !reader.isFail())
+					mRoot = parseBinaryElement(reader, nullptr);
+			}
+
+			if (reader.isFail() || !reader.isEnd())
+			{
+				clearDeclaration();
+				clearRoot();
+				mLastError = ErrorType::IncorrectContent;
+				return false;
+			}
+
+			return true;
+		}
+
+		ElementPtr Document::parseBinaryElement(BinaryReader& _reader, ElementPtr _parent)
+		{
+			size_t type = _reader.readNumber();
+			size_t name = _reader.readString();
+			size_t content = _reader.readString();
+			if (type >= ElementType::MAX)
+				_reader.setFail();
+			if (_reader.isFail())
+				return nullptr;
+
+			ElementPtr element = nullptr;
+			if (mArena != nullptr)
+				element = mArena->createElement(_reader.getAtom(name, mArena), _parent, ElementType((ElementType::Enum)type));
+			else
+				element = new Element(std::string(_reader.getData(name), _reader.getSize(name)), _parent, ElementType((ElementType::Enum)type));
+			if (_parent != nullptr)
+				_parent->mChilds.push_back(element);
+
+			element->mContent.assign(_reader.getData(content), _reader.getSize(content));
+
+			size_t count = _reader.readNumber();
+			for (size_t index = 0; index < count && !_reader.isFail(); ++index)
+			{
+				size_t key = _reader.readString();
+				size_t value = _reader.readString();
+				if (_reader.isFail())
+					break;
+
+				if (mArena != nullptr)
+					mArena->addAttribute(_reader.getAtom(key, mArena), _reader.getData(value), _reader.getSize(value));
+				else
+					element->mAttributes.push_back(PairAttribute(std::string(_reader.getData(key), _reader.getSize(key)), std::string(_reader.getData(value), _reader.getSize(value))));
+			}
+
+			if (mArena != nullptr)
+				mArena->setAttributes(element);
+
+			count = _reader.readNumber();
+			for (size_t index = 0; index < count && !_reader.isFail(); ++index)
+				parseBinaryElement(_reader, element);
+
+			// дети уже в узле, удаляются вместе с ним
+			if (_reader.isFail() && _parent == nullptr)
+			{
+				Element::destroy(element);
+				return nullptr;
+			}
+
+			return element;
+		}
+
+		ElementPtr Document::createElement(const char* _begin, const char* _end, ElementPtr _parent, ElementType _type)
+		{
+			ElementPtr element = nullptr;
+			if (mArena != nullptr)
+				element = mArena->createElement(_begin, _end, _parent, _type);
+			else
+				element = new Element(std::string(_begin, _end), _parent, _type);
+
+			if (_parent != nullptr)
+				_parent->mChilds.push_back(element);
+			return element;
+		}
+
+		bool Document::parseTag(ElementPtr& _currentNode, const char* _begin, const char* _end)
+		{
+			// убераем лишнее
+			utility::trim(_begin, _end);
+
+			if (_begin == _end)
+			{
+				// создаем пустой тег
+				_currentNode = createElement(_begin, _end, _currentNode, ElementType::Normal);
+				// если это первый то запоминаем
+				if (!_currentNode->getParent() && !mRoot)
+					mRoot = _currentNode;
 				return true;
 			}
 
-			char simbol = _content[0];
+			char simbol = *_begin;
 			bool tagDeclaration = false;
 
 			// проверяем на коментарии
 			if (simbol == '!')
 			{
-				if (_currentNode != 0)
-				{
-					//_currentNode->createChild("", _content, ElementType::Comment);
-				}
 				return true;
 			}
 			// проверяем на информационный тег
 			else if (simbol == '?')
 			{
 				tagDeclaration = true;
-				_content.erase(0, 1); // удаляем первый символ
+				++_begin; // пропускаем первый символ
 			}
 
-			size_t start = 0;
-			size_t end = 0;
 			// проверяем на закрытие тега
 			if (simbol == '/')
 			{
+				// чета мы закрывам а ниче даже и не открыто
 				if (_currentNode == 0)
 				{
-					// чета мы закрывам а ниче даже и не открыто
-					if (!mRoot)
-					{
-						mLastError = ErrorType::CloseNotOpenedElement;
-						return false;
-					}
+					mLastError = ErrorType::CloseNotOpenedElement;
+					return false;
 				}
+
 				// обрезаем имя тэга
-				start = _content.find_first_not_of(" \t", 1);
-				if (start == _content.npos)
-				{
-					// тег пустой
-					_content.clear();
-				}
-				else
-				{
-					end = _content.find_last_not_of(" \t");
-					_content = _content.substr(start, end - start + 1);
-				}
+				++_begin;
+				utility::trim(_begin, _end);
+
 				// проверяем соответствие открывающего и закрывающего тегов
-				if (_currentNode->getName() != _content)
+				if (_currentNode->getName().compare(0, std::string::npos, _begin, _end - _begin) != 0)
 				{
 					mLastError = ErrorType::InconsistentOpenCloseElements;
 					return false;
 				}
 				// а теперь снижаем текущий узел вниз
 				_currentNode = _currentNode->getParent();
+				return true;
+			}
+
+			// выделяем имя до первого пробела или закрывающего тега
+			const char* nameEnd = _begin;
+			if (nameEnd != _end)
+				++nameEnd;
+			while (nameEnd != _end && !utility::is_space(*nameEnd) && *nameEnd != '/' && *nameEnd != '?')
+				++nameEnd;
+
+			if (_currentNode)
+			{
+				_currentNode = createElement(_begin, nameEnd, _currentNode, ElementType::Normal);
 			}
 			else
 			{
-				// выделяем имя до первого пробела или закрывающего тега
-				std::string cut = _content;
-				start = _content.find_first_of(" \t/?", 1); // << превед
-				if (start != _content.npos)
+				if (tagDeclaration)
 				{
-					cut = _content.substr(0, start);
-					_content = _content.substr(start);
-				}
-				else
-				{
-					_content.clear();
-				}
-
-				if (_currentNode)
-				{
-					_currentNode = _currentNode->createChild(cut);
+					// информационный тег
+					if (mDeclaration)
+					{
+						mLastError = ErrorType::MoreThanOneXMLDeclaration;
+						return false;
+					}
+					_currentNode = createElement(_begin, nameEnd, nullptr, ElementType::Declaration);
+					mDeclaration = _currentNode;
 				}
 				else
 				{
-					if (tagDeclaration)
-					{
-						// информационный тег
-						if (mDeclaration)
-						{
-							mLastError = ErrorType::MoreThanOneXMLDeclaration;
-							return false;
-						}
-						_currentNode = new Element(cut, 0, ElementType::Declaration);
-						mDeclaration = _currentNode;
-					}
-					else
+					// рутовый тег
+					if (mRoot)
 					{
-						// рутовый тег
-						if (mRoot)
-						{
-							mLastError = ErrorType::MoreThanOneRootElement;
-							return false;
-						}
-						_currentNode = new Element(cut, 0, ElementType::Normal);
-						mRoot = _currentNode;
+						mLastError = ErrorType::MoreThanOneRootElement;
+						return false;
 					}
+					_currentNode = createElement(_begin, nameEnd, nullptr, ElementType::Normal);
+					mRoot = _currentNode;
 				}
+			}
 
-				// проверим на пустоту
-				start = _content.find_last_not_of(" \t");
-				if (start == _content.npos)
-					return true;
+			// проверим на пустоту
+			const char* position = nameEnd;
+			utility::trim(position, _end);
+			if (position == _end)
+				return true;
 
-				// сразу отделим закрывающийся тэг
-				bool close = false;
-				if ((_content[start] == '/') || (_content[start] == '?'))
+			// сразу отделим закрывающийся тэг
+			bool close = false;
+			if ((*(_end - 1) == '/') || (*(_end - 1) == '?'))
+			{
+				close = true;
+				--_end;
+				utility::trim(position, _end);
+			}
+
+			// а вот здесь уже в цикле разбиваем на атрибуты
+			while (position != _end)
+			{
+				// ищем равно
+				const char* equal = std::find(position, _end, '=');
+				if (equal == _end)
 				{
-					close = true;
-					// не будем резать строку, просто поставим пробел
-					_content[start] = ' ';
-					// проверим на пустоту
-					start = _content.find_last_not_of(" \t");
-					if (start == _content.npos)
-					{
-						// возвращаем все назад и уходим
-						_currentNode = _currentNode->getParent();
-						return true;
-					}
+					mLastError = ErrorType::IncorrectAttribute;
+					return false;
 				}
 
-				// а вот здесь уже в цикле разбиваем на атрибуты
-				while (true)
+				// значение в ковычках
+				const char* quote = equal + 1;
+				while (quote != _end && utility::is_space(*quote))
+					++quote;
+				if ((quote == _end) || ((*quote != '"') && (*quote != '\'')))
 				{
-					// ищем равно
-					start = _content.find('=');
-					if (start == _content.npos)
-					{
-						mLastError = ErrorType::IncorrectAttribute;
-						return false;
-					}
-					// ищем вторые ковычки
-					end = _content.find_first_of("\"\'", start + 1);
-					if (end == _content.npos)
-					{
-						mLastError = ErrorType::IncorrectAttribute;
-						return false;
-					}
-					end = _content.find_first_of("\"\'", end + 1);
-					if (end == _content.npos)
-					{
-						mLastError = ErrorType::IncorrectAttribute;
-						return false;
-					}
-
-					std::string key = _content.substr(0, start);
-					std::string value = _content.substr(start + 1, end - start);
+					mLastError = ErrorType::IncorrectAttribute;
+					return false;
+				}
+				const char* quoteEnd = std::find(quote + 1, _end, *quote);
+				if (quoteEnd == _end)
+				{
+					mLastError = ErrorType::IncorrectAttribute;
+					return false;
+				}
 
-					// проверка на валидность
-					if (! checkPair(key, value))
+				// в ключе не должно быть ковычек и пробелов
+				const char* keyEnd = equal;
+				utility::trim(position, keyEnd);
+				if (position == keyEnd)
+				{
+					mLastError = ErrorType::IncorrectAttribute;
+					return false;
+				}
+				for (const char* iter = position; iter != keyEnd; ++iter)
+				{
+					if (utility::is_space(*iter) || (*iter == '"') || (*iter == '\'') || (*iter == '&'))
 					{
 						mLastError = ErrorType::IncorrectAttribute;
 						return false;
 					}
+				}
 
-					// добавляем пару в узел
-					_currentNode->addAttribute(key, value);
-
-					// следующий кусок
-					_content = _content.substr(end + 1);
-
-					// в строке не осталось символов
-					start = _content.find_first_not_of(" \t");
-					if (start == _content.npos)
-						break;
-
-					mCol += start;
+				// добавляем пару в узел
+				bool ok = true;
+				if (mArena != nullptr)
+				{
+					ok = mArena->addAttribute(position, keyEnd, quote + 1, quoteEnd);
+				}
+				else
+				{
+					_currentNode->mAttributes.push_back(PairAttribute(std::string(position, keyEnd), std::string()));
+					ok = utility::convert_from_xml(quote + 1, quoteEnd, _currentNode->mAttributes.back().second);
 				}
 
-				// был закрывающий тег для текущего тега
-				if (close)
+				if (!ok)
 				{
-					// не проверяем имена, потому что это наш тэг
-					_currentNode = _currentNode->getParent();
+					mLastError = ErrorType::IncorrectAttribute;
+					return false;
 				}
 
+				// следующий кусок
+				position = quoteEnd + 1;
+				utility::trim(position, _end);
 			}
-			return true;
-		}
-
-		bool Document::checkPair(std::string& _key, std::string& _value)
-		{
-			// в ключе не должно быть ковычек и пробелов
-			MyGUI::utility::trim(_key);
-			if (_key.empty())
-				return false;
-			size_t start = _key.find_first_of(" \t\"\'&");
-			if (start != _key.npos)
-				return false;
 
-			// в значении, ковычки по бокам
-			MyGUI::utility::trim(_value);
-			if (_value.size() < 2)
-				return false;
-			if (((_value[0] != '"') || (_value[_value.length() - 1] != '"')) &&
-				((_value[0] != '\'') || (_value[_value.length() - 1] != '\'')))
-				return false;
-			bool ok = true;
-			_value = utility::convert_from_xml(_value.substr(1, _value.length() - 2), ok);
-			return ok;
-		}
-
-		// ищет символ без учета ковычек
-		size_t Document::find(const std::string& _text, char _char, size_t _start)
-		{
-			// ковычки
-			bool kov = false;
-
-			// буфер для поиска
-			char buff[16] = "\"_\0";
-			buff[1] = _char;
+			// атрибуты из арены одним куском
+			if (mArena != nullptr)
+				mArena->setAttributes(_currentNode);
 
-			size_t pos = _start;
-
-			while (true)
+			// был закрывающий тег для текущего тега
+			if (close)
 			{
-				pos = _text.find_first_of(buff, pos);
-
-				// если уже конец, то досвидания
-				if (pos == _text.npos)
-				{
-					break;
-				}
-				// нашли ковычку
-				else if (_text[pos] == '"')
-				{
-					kov = !kov;
-					pos ++;
-				}
-				// если мы в ковычках, то идем дальше
-				else if (kov)
-				{
-					pos ++;
-				}
-				// мы не в ковычках
-				else
-				{
-					break;
-				}
+				// не проверяем имена, потому что это наш тэг
+				_currentNode = _currentNode->getParent();
 			}
 
-			return pos;
+			return true;
+		}
+
+		void Document::setLastErrorPosition(const char* _begin, const char* _position)
+		{
+			mLine = 1 + std::count(_begin, _position, '\n');
+			const char* line = _position;
+			while (line != _begin && *(line - 1) != '\n')
+				--line;
+			mCol = _position - line;
 		}
 
 		void Document::clearDeclaration()
 		{
 			if (mDeclaration)
 			{
-				delete mDeclaration;
+				Element::destroy(mDeclaration);
 				mDeclaration = 0;
 			}
 		}
@@ -845,7 +1472,7 @@ namespace MyGUI
 		{
 			if (mRoot)
 			{
-				delete mRoot;
+				Element::destroy(mRoot);
 				mRoot = 0;
 			}
 		}
@@ -866,61 +1493,6 @@ namespace MyGUI
 			return mRoot;
 		}
 
-		bool Document::parseLine(std::string& _line, ElementPtr& _element)
-		{
-			// крутимся пока в строке есть теги
-			while (true)
-			{
-				// сначала ищем по угловым скобкам
-				size_t start = find(_line, '<');
-				if (start == _line.npos)
-					break;
-				size_t end = _line.npos;
-
-				// пытаемся вырезать многострочный коментарий
-				if ((start + 3 < _line.size()) && (_line[start + 1] == '!') && (_line[start + 2] == '-') && (_line[start + 3] == '-'))
-				{
-					end = _line.find("-->", start + 4);
-					if (end == _line.npos)
-						break;
-					end += 2;
-				}
-				else
-				{
-					end = find(_line, '>', start + 1);
-					if (end == _line.npos)
-						break;
-				}
-				// проверяем на наличее тела
-				size_t body = _line.find_first_not_of(" \t<");
-				if (body < start)
-				{
-					std::string body_str = _line.substr(0, start);
-					// текущий символ
-					mCol = 0;
-
-					if (_element != 0)
-					{
-						bool ok = true;
-						_element->setContent(utility::convert_from_xml(body_str, ok));
-						if (!ok)
-						{
-							mLastError = ErrorType::IncorrectContent;
-							return false;
-						}
-					}
-				}
-				// вырезаем наш тэг и парсим
-				if (!parseTag(_element, _line.substr(start + 1, end - start - 1)))
-				{
-					return false;
-				}
-				// и обрезаем текущую строку разбора
-				_line = _line.substr(end + 1);
-			}
-			return true;
-		}
-
 		std::string Document::getLastError()
 		{
 			const std::string& error = mLastError.print();
@@ -949,6 +1521,16 @@ namespace MyGUI
 			return mRoot;
 		}
 
+		void Document::setArenaAllocation(bool _value)
+		{
+			mArenaAllocation = _value;
+		}
+
+		bool Document::getArenaAllocation() const
+		{
+			return mArenaAllocation;
+		}
+
 		void Document::setLastFileError(const std::string& _filename)
 		{
 			mLastErrorFile = _filename;
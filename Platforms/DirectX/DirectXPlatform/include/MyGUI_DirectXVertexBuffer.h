@@ -9,6 +9,7 @@
 
 #include "MyGUI_Prerequest.h"
 #include "MyGUI_IVertexBuffer.h"
+#include "MyGUI_VertexBufferCapacity.h"
 #include "MyGUI_DirectXRenderManager.h"
 
 struct IDirect3DDevice9;
@@ -28,6 +29,9 @@ namespace MyGUI
 
 		virtual Vertex* lock();
 		virtual void unlock();
+		virtual bool checkShrink();
+
+		virtual Vertex* lockRange(size_t _start, size_t _count);
 
 	/*internal:*/
 		virtual bool setToStream(size_t stream);
@@ -42,7 +46,7 @@ namespace MyGUI
 		IDirect3DVertexBuffer9* mpBuffer;
 		DirectXRenderManager* pRenderManager;
 
-		size_t mVertexCount;
+		VertexBufferCapacity mCapacity;
 		size_t mNeedVertexCount;
 	};
 
@@ -7,17 +7,23 @@
 #include "MyGUI_DirectXDataManager.h"
 #include "MyGUI_DirectXDiagnostic.h"
 #include "MyGUI_DataFileStream.h"
-#include "FileSystemInfo/FileSystemInfo.h"
+#include "FileSystemInfo/DataFileIndex.h"
 #include <fstream>
 
 namespace MyGUI
 {
 
 	DirectXDataManager::DirectXDataManager() :
+		mIndex(new common::DataFileIndex()),
 		mIsInitialise(false)
 	{
 	}
 
+	DirectXDataManager::~DirectXDataManager()
+	{
+		delete mIndex;
+	}
+
 	void DirectXDataManager::initialise()
 	{
 		MYGUI_PLATFORM_ASSERT(!mIsInitialise, getClassTypeName() << " initialised twice");
@@ -73,10 +79,7 @@ namespace MyGUI
 		common::VectorWString wresult;
 		result.clear();
 
-		for (VectorArhivInfo::const_iterator item = mPaths.begin(); item != mPaths.end(); ++item)
-		{
-			common::scanFolder(wresult, (*item).name, (*item).recursive, MyGUI::UString(_pattern).asWStr(), false);
-		}
+		mIndex->scan(wresult, MyGUI::UString(_pattern).asWStr(), false);
 
 		for (common::VectorWString::const_iterator item = wresult.begin(); item != wresult.end(); ++item)
 		{
@@ -92,10 +95,7 @@ namespace MyGUI
 		VectorString result;
 		common::VectorWString wresult;
 
-		for (VectorArhivInfo::const_iterator item = mPaths.begin(); item != mPaths.end(); ++item)
-		{
-			common::scanFolder(wresult, (*item).name, (*item).recursive, MyGUI::UString(_name).asWStr(), true);
-		}
+		mIndex->scan(wresult, MyGUI::UString(_name).asWStr(), true);
 
 		for (common::VectorWString::const_iterator item = wresult.begin(); item != wresult.end(); ++item)
 		{
@@ -123,10 +123,12 @@ namespace MyGUI
 
 	void DirectXDataManager::addResourceLocation(const std::string& _name, bool _recursive)
 	{
-		ArhivInfo info;
-		info.name = MyGUI::UString(_name).asWStr();
-		info.recursive = _recursive;
-		mPaths.push_back(info);
+		mIndex->addLocation(MyGUI::UString(_name).asWStr(), _recursive);
+	}
+
+	void DirectXDataManager::setCheckLocationChanges(bool _value)
+	{
+		mIndex->setCheckChanges(_value);
 	}
 
 } // namespace MyGUI
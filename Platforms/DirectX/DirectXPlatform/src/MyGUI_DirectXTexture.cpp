@@ -6,7 +6,7 @@
 
 #include <d3dx9.h>
 #include "MyGUI_DirectXTexture.h"
-#include "MyGUI_DirectXDataManager.h"
+#include "MyGUI_DataStreamHolder.h"
 #include "MyGUI_DirectXRTTexture.h"
 #include "MyGUI_DirectXDiagnostic.h"
 
@@ -101,10 +101,16 @@ namespace MyGUI
 		mPixelFormat = PixelFormat::R8G8B8A8;
 		mNumElemBytes = 4;
 
-		std::string fullname = DirectXDataManager::getInstance().getDataPath(_filename);
+		// texture is read through DataManager, it can be not a file on disk
+		DataStreamHolder data(DataManager::getInstance().getData(_filename));
+		if (data.getData() == nullptr || data.getData()->size() == 0)
+			MYGUI_PLATFORM_EXCEPT("Failed to load texture '" << _filename << "'.");
+
+		std::vector<uint8> buffer(data.getData()->size());
+		size_t size = data.getData()->read(&buffer[0], buffer.size());
 
 		D3DXIMAGE_INFO info;
-		D3DXGetImageInfoFromFile(fullname.c_str(), &info);
+		D3DXGetImageInfoFromFileInMemory(&buffer[0], (UINT)size, &info);
 
 		if (info.Format == D3DFMT_A8R8G8B8)
 		{
@@ -128,7 +134,7 @@ namespace MyGUI
 		}
 
 		mSize.set(info.Width, info.Height);
-		HRESULT result = D3DXCreateTextureFromFile(mpD3DDevice, fullname.c_str(), &mpTexture);
+		HRESULT result = D3DXCreateTextureFromFileInMemory(mpD3DDevice, &buffer[0], (UINT)size, &mpTexture);
 		if (FAILED(result))
 		{
 			MYGUI_PLATFORM_EXCEPT("Failed to load texture '" << _filename <<
@@ -12,12 +12,8 @@
 namespace MyGUI
 {
 
-	const size_t VERTEX_IN_QUAD = 6;
-	const size_t RENDER_ITEM_STEEP_REALLOCK = 5 * VERTEX_IN_QUAD;
-
 	DirectXVertexBuffer::DirectXVertexBuffer(IDirect3DDevice9* _device, DirectXRenderManager* _pRenderManager) :
 		mNeedVertexCount(0),
-		mVertexCount(RENDER_ITEM_STEEP_REALLOCK),
 		mpD3DDevice(_device),
 		pRenderManager(_pRenderManager),
 		mpBuffer(NULL)
@@ -31,11 +27,8 @@ namespace MyGUI
 
 	void DirectXVertexBuffer::setVertexCount(size_t _count)
 	{
-		if (_count != mNeedVertexCount)
-		{
-			mNeedVertexCount = _count;
-			resize();
-		}
+		// buffer is reallocated on lock, only if it's capacity is not suitable
+		mNeedVertexCount = _count;
 	}
 
 	size_t DirectXVertexBuffer::getVertexCount()
@@ -43,8 +36,16 @@ namespace MyGUI
 		return mNeedVertexCount;
 	}
 
+	bool DirectXVertexBuffer::checkShrink()
+	{
+		return mCapacity.checkShrink(mNeedVertexCount);
+	}
+
 	Vertex* DirectXVertexBuffer::lock()
 	{
+		if (mCapacity.update(mNeedVertexCount))
+			resize();
+
 		void* lockPtr = nullptr;
 		HRESULT result = mpBuffer->Lock(0, 0, (void**)&lockPtr, 0);
 		if (FAILED(result))
@@ -54,6 +55,17 @@ namespace MyGUI
 		return reinterpret_cast<Vertex*>(lockPtr);
 	}
 
+	Vertex* DirectXVertexBuffer::lockRange(size_t _start, size_t _count)
+	{
+		void* lockPtr = nullptr;
+		HRESULT result = mpBuffer->Lock(_start * sizeof(MyGUI::Vertex), _count * sizeof(MyGUI::Vertex), (void**)&lockPtr, 0);
+		if (FAILED(result))
+		{
+			MYGUI_PLATFORM_EXCEPT("Failed to lock vertex buffer (error code " << result << ").");
+		}
+		return reinterpret_cast<Vertex*>(lockPtr);
+	}
+
 	void DirectXVertexBuffer::unlock()
 	{
 		HRESULT result = mpBuffer->Unlock();
@@ -72,7 +84,7 @@ namespace MyGUI
 
 	bool DirectXVertexBuffer::create()
 	{
-		DWORD length = mNeedVertexCount * sizeof(MyGUI::Vertex);
+		DWORD length = mCapacity.getCapacity() * sizeof(MyGUI::Vertex);
 		if (SUCCEEDED(mpD3DDevice->CreateVertexBuffer(length, 0, 0, D3DPOOL_MANAGED, &mpBuffer, nullptr)))
 			return false;
 		return false;
@@ -9,6 +9,7 @@
 
 #include "MyGUI_Prerequest.h"
 #include "MyGUI_IVertexBuffer.h"
+#include "MyGUI_VertexBufferCapacity.h"
 #include "MyGUI_DirectX11RenderManager.h"
 
 struct ID3D11Buffer;
@@ -27,6 +28,7 @@ namespace MyGUI
 
 		virtual Vertex* lock();
 		virtual void unlock();
+		virtual bool checkShrink();
 
 	private:
 		bool create();
@@ -35,7 +37,7 @@ namespace MyGUI
 
 	private:
 		DirectX11RenderManager* mManager;
-		size_t                  mVertexCount;
+		VertexBufferCapacity    mCapacity;
 		size_t                  mNeedVertexCount;
 
 	public:
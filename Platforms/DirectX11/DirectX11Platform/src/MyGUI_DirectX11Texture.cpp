@@ -6,7 +6,7 @@
 
 #include <d3dx11.h>
 #include "MyGUI_DirectX11Texture.h"
-#include "MyGUI_DirectX11DataManager.h"
+#include "MyGUI_DataStreamHolder.h"
 #include "MyGUI_DirectX11RenderManager.h"
 #include "MyGUI_DirectX11RTTexture.h"
 #include "MyGUI_DirectX11Diagnostic.h"
@@ -74,11 +74,15 @@ namespace MyGUI
 	{
 		destroy();
 
-		std::string fullname = DirectX11DataManager::getInstance().getDataPath(_filename);
+		// texture is read through DataManager, it can be not a file on disk
+		DataStreamHolder data(DataManager::getInstance().getData(_filename));
+		MYGUI_PLATFORM_ASSERT(data.getData() != nullptr && data.getData()->size() != 0, "Failed to load texture '" << _filename << "'");
 
+		std::vector<uint8> buffer(data.getData()->size());
+		size_t size = data.getData()->read(&buffer[0], buffer.size());
 
 		D3DX11_IMAGE_INFO fileInfo;
-		D3DX11GetImageInfoFromFile( fullname.c_str(), NULL, &fileInfo, NULL );
+		D3DX11GetImageInfoFromMemory( &buffer[0], size, NULL, &fileInfo, NULL );
 
 		mWidth = fileInfo.Width;
 		mHeight = fileInfo.Height;
@@ -97,7 +101,7 @@ namespace MyGUI
 		loadInfo.MipFilter      = D3DX11_FILTER_NONE;
 		loadInfo.pSrcInfo       = &fileInfo;
 
-		HRESULT hr = D3DX11CreateTextureFromFileA( mManager->mpD3DDevice, fullname.c_str(), &loadInfo, NULL, (ID3D11Resource**)&mTexture, NULL );
+		HRESULT hr = D3DX11CreateTextureFromMemory( mManager->mpD3DDevice, &buffer[0], size, &loadInfo, NULL, (ID3D11Resource**)&mTexture, NULL );
 		MYGUI_PLATFORM_ASSERT(hr == S_OK, "CreateTextureFromFile failed!");
 
 		D3D11_TEXTURE2D_DESC desc;
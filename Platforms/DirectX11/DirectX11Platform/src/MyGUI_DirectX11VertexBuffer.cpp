@@ -12,12 +12,8 @@
 namespace MyGUI
 {
 
-	const size_t VERTEX_IN_QUAD = 6;
-	const size_t RENDER_ITEM_STEEP_REALLOCK = 5 * VERTEX_IN_QUAD;
-
 	DirectX11VertexBuffer::DirectX11VertexBuffer(DirectX11RenderManager* _pRenderManager) :
 		mNeedVertexCount(0),
-		mVertexCount(RENDER_ITEM_STEEP_REALLOCK),
 		mBuffer(nullptr),
 		mManager(_pRenderManager)
 	{
@@ -30,11 +26,8 @@ namespace MyGUI
 
 	void DirectX11VertexBuffer::setVertexCount(size_t _count)
 	{
-		if (_count != mNeedVertexCount && _count != 0)
-		{
-			mNeedVertexCount = _count;
-			resize();
-		}
+		// buffer is reallocated on lock, only if it's capacity is not suitable
+		mNeedVertexCount = _count;
 	}
 
 	size_t DirectX11VertexBuffer::getVertexCount()
@@ -42,9 +35,15 @@ namespace MyGUI
 		return mNeedVertexCount;
 	}
 
+	bool DirectX11VertexBuffer::checkShrink()
+	{
+		return mCapacity.checkShrink(mNeedVertexCount);
+	}
+
 	Vertex* DirectX11VertexBuffer::lock()
 	{
-		if (!mBuffer) create();
+		if (mCapacity.update(mNeedVertexCount))
+			resize();
 		D3D11_MAPPED_SUBRESOURCE map;
 		memset(&map, 0, sizeof(map));
 		mManager->mpD3DContext->Map(mBuffer, 0, D3D11_MAP_WRITE_DISCARD, 0, &map);
@@ -63,7 +62,7 @@ namespace MyGUI
 		desc.CPUAccessFlags = D3D11_CPU_ACCESS_WRITE;
 		desc.MiscFlags = 0;
 		desc.StructureByteStride = 0;
-		desc.ByteWidth = sizeof(Vertex) * (mNeedVertexCount);
+		desc.ByteWidth = sizeof(Vertex) * (mCapacity.getCapacity());
 		desc.Usage = D3D11_USAGE_DYNAMIC;
 		HRESULT hr = mManager->mpD3DDevice->CreateBuffer(&desc, 0, &mBuffer);
 		MYGUI_PLATFORM_ASSERT(hr == S_OK, "Create Buffer failed!");
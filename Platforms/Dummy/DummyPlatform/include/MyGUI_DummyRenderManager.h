@@ -10,10 +10,42 @@
 #include "MyGUI_Prerequest.h"
 #include "MyGUI_RenderFormat.h"
 #include "MyGUI_RenderManager.h"
+#include <map>
+#include <vector>
 
 namespace MyGUI
 {
 
+	struct DummyDrawCall
+	{
+		DummyDrawCall(ITexture* _texture, size_t _vertexCount) :
+			texture(_texture),
+			vertexCount(_vertexCount)
+		{
+		}
+
+		ITexture* texture;
+		size_t vertexCount;
+	};
+
+	struct DummyFrameStatistics
+	{
+		DummyFrameStatistics() :
+			drawCalls(0),
+			textureBinds(0),
+			verticesRendered(0),
+			verticesUploaded(0),
+			bytesUploaded(0)
+		{
+		}
+
+		size_t drawCalls;
+		size_t textureBinds;
+		size_t verticesRendered;
+		size_t verticesUploaded;
+		size_t bytesUploaded;
+	};
+
 	class DummyRenderManager :
 		public RenderManager,
 		public IRenderTarget
@@ -59,6 +91,8 @@ namespace MyGUI
 
 		/** @see RenderManager::isFormatSupported */
 		virtual bool isFormatSupported(PixelFormat _format, TextureUsage _usage);
+		/** @see RenderManager::isShaderSupported */
+		virtual bool isShaderSupported(const std::string& _shaderName);
 
 		/** @see IRenderTarget::begin */
 		virtual void begin();
@@ -74,13 +108,34 @@ namespace MyGUI
 			return mInfo;
 		}
 
+		/** Get device statistics (draws, binds, uploads) of last frame drawn by drawOneFrame */
+		const DummyFrameStatistics& getDeviceStatistics() const;
+		/** Get draw calls recorded during last frame */
+		const std::vector<DummyDrawCall>& getDrawCalls() const;
+
 		/*internal:*/
-		void drawOneFrame();
+		/** Draw frame, with _update set all vertices are regenerated (full redraw) */
+		void drawOneFrame(bool _update = false);
 		void setViewSize(int _width, int _height);
+		void _notifyBytesUploaded(size_t _bytes);
+		void _notifyVerticesUploaded(size_t _count);
+
+	private:
+		void destroyAllResources();
 
 	private:
 		IntSize mViewSize;
 		RenderTargetInfo mInfo;
+		bool mIsInitialise;
+
+		typedef std::map<std::string, ITexture*> MapTexture;
+		MapTexture mTextures;
+
+		ITexture* mLastTexture;
+		DummyFrameStatistics mStatistics;
+		DummyFrameStatistics mLastStatistics;
+		std::vector<DummyDrawCall> mDrawCalls;
+		std::vector<DummyDrawCall> mLastDrawCalls;
 	};
 
 } // namespace MyGUI
@@ -0,0 +1,64 @@
+/*
+ * This source file is part of MyGUI. For the latest info, see http://mygui.info/
+ * Distributed under the MIT License
+ * (See accompanying file COPYING.MIT or copy at http://opensource.org/licenses/MIT)
+ */
+
+#ifndef MYGUI_DUMMY_TEXTURE_H_
+#define MYGUI_DUMMY_TEXTURE_H_
+
+#include "MyGUI_Prerequest.h"
+#include "MyGUI_ITexture.h"
+#include "MyGUI_RenderFormat.h"
+#include "MyGUI_Types.h"
+
+namespace MyGUI
+{
+
+	/** Texture in system memory.
+		Images are not decoded, only size of PNG files is read so texture coordinates are valid.
+	*/
+	class DummyTexture : public ITexture
+	{
+	public:
+		DummyTexture(const std::string& _name);
+		virtual ~DummyTexture();
+
+		virtual const std::string& getName() const;
+
+		virtual void createManual(int _width, int _height, TextureUsage _usage, PixelFormat _format);
+		virtual void loadFromFile(const std::string& _filename);
+		virtual void saveToFile(const std::string& _filename);
+
+		virtual void destroy();
+
+		virtual void* lock(TextureUsage _access);
+		virtual void unlock();
+		virtual bool isLocked();
+		virtual bool updateRegion(const IntCoord& _coord, const void* _data);
+
+		virtual int getWidth();
+		virtual int getHeight();
+
+		virtual PixelFormat getFormat();
+		virtual TextureUsage getUsage();
+		virtual size_t getNumElemBytes();
+
+	private:
+		bool readImageSize(const std::string& _filename, int& _width, int& _height);
+
+	private:
+		std::string mName;
+		int mWidth;
+		int mHeight;
+		PixelFormat mPixelFormat;
+		TextureUsage mUsage;
+		size_t mNumElemBytes;
+		std::vector<uint8> mBuffer;
+		bool mLock;
+		bool mWriteLock;
+	};
+
+} // namespace MyGUI
+
+#endif // MYGUI_DUMMY_TEXTURE_H_
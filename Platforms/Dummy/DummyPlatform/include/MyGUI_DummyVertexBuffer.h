@@ -0,0 +1,46 @@
+/*
+ * This source file is part of MyGUI. For the latest info, see http://mygui.info/
+ * Distributed under the MIT License
+ * (See accompanying file COPYING.MIT or copy at http://opensource.org/licenses/MIT)
+ */
+
+#ifndef MYGUI_DUMMY_VERTEX_BUFFER_H_
+#define MYGUI_DUMMY_VERTEX_BUFFER_H_
+
+#include "MyGUI_Prerequest.h"
+#include "MyGUI_IVertexBuffer.h"
+#include "MyGUI_VertexBufferCapacity.h"
+#include <vector>
+
+namespace MyGUI
+{
+
+	/** Vertex buffer in system memory, locked ranges are counted as uploaded bytes */
+	class DummyVertexBuffer : public IVertexBuffer
+	{
+	public:
+		DummyVertexBuffer();
+		virtual ~DummyVertexBuffer();
+
+		virtual void setVertexCount(size_t _count);
+		virtual size_t getVertexCount();
+
+		virtual Vertex* lock();
+		virtual void unlock();
+		virtual bool checkShrink();
+
+		virtual Vertex* lockRange(size_t _start, size_t _count);
+
+	/*internal:*/
+		const Vertex* getData() const;
+
+	private:
+		std::vector<Vertex> mBuffer;
+		VertexBufferCapacity mCapacity;
+		size_t mNeedVertexCount;
+		size_t mLockedCount;
+	};
+
+} // namespace MyGUI
+
+#endif // MYGUI_DUMMY_VERTEX_BUFFER_H_
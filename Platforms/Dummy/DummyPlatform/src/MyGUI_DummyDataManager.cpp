@@ -7,31 +7,59 @@
 #include "MyGUI_DummyDataManager.h"
 #include "MyGUI_DummyDiagnostic.h"
 #include "MyGUI_DataFileStream.h"
+#include "FileSystemInfo/DataFileIndex.h"
+#include <fstream>
 
 namespace MyGUI
 {
 
-	DummyDataManager::DummyDataManager()
+	DummyDataManager::DummyDataManager() :
+		mIndex(new common::DataFileIndex()),
+		mIsInitialise(false)
 	{
 	}
 
+	DummyDataManager::~DummyDataManager()
+	{
+		delete mIndex;
+	}
+
 	void DummyDataManager::initialise()
 	{
+		MYGUI_PLATFORM_ASSERT(!mIsInitialise, getClassTypeName() << " initialised twice");
 		MYGUI_PLATFORM_LOG(Info, "* Initialise: " << getClassTypeName());
 
 		MYGUI_PLATFORM_LOG(Info, getClassTypeName() << " successfully initialized");
+		mIsInitialise = true;
 	}
 
 	void DummyDataManager::shutdown()
 	{
+		MYGUI_PLATFORM_ASSERT(mIsInitialise, getClassTypeName() << " is not initialised");
 		MYGUI_PLATFORM_LOG(Info, "* Shutdown: " << getClassTypeName());
 
 		MYGUI_PLATFORM_LOG(Info, getClassTypeName() << " successfully shutdown");
+		mIsInitialise = false;
 	}
 
 	IDataStream* DummyDataManager::getData(const std::string& _name)
 	{
-		return nullptr;
+		std::string filepath = getDataPath(_name);
+		if (filepath.empty())
+			return nullptr;
+
+		std::ifstream* stream = new std::ifstream();
+		stream->open(filepath.c_str(), std::ios_base::binary);
+
+		if (!stream->is_open())
+		{
+			delete stream;
+			return nullptr;
+		}
+
+		DataFileStream* data = new DataFileStream(stream);
+
+		return data;
 	}
 
 	void DummyDataManager::freeData(IDataStream* _data)
@@ -41,19 +69,68 @@ namespace MyGUI
 
 	bool DummyDataManager::isDataExist(const std::string& _name)
 	{
-		return false;
+		const VectorString& files = getDataListNames(_name);
+		return !files.empty();
 	}
 
 	const VectorString& DummyDataManager::getDataListNames(const std::string& _pattern)
 	{
 		static VectorString result;
+		common::VectorWString wresult;
+		result.clear();
+
+		mIndex->scan(wresult, MyGUI::UString(_pattern).asWStr(), false);
+
+		for (common::VectorWString::const_iterator item = wresult.begin(); item != wresult.end(); ++item)
+		{
+			result.push_back(MyGUI::UString(*item).asUTF8());
+		}
+
 		return result;
 	}
 
 	const std::string& DummyDataManager::getDataPath(const std::string& _name)
 	{
-		static std::string result;
-		return result;
+		static std::string path;
+		VectorString result;
+		common::VectorWString wresult;
+		path.clear();
+
+		mIndex->scan(wresult, MyGUI::UString(_name).asWStr(), true);
+
+		for (common::VectorWString::const_iterator item = wresult.begin(); item != wresult.end(); ++item)
+		{
+			result.push_back(MyGUI::UString(*item).asUTF8());
+		}
+
+		if (!result.empty())
+		{
+			path = result[0];
+			if (result.size() > 1)
+			{
+				MYGUI_PLATFORM_LOG(Warning, "There are several files with name '" << _name << "'. '" << path << "' was used.");
+				MYGUI_PLATFORM_LOG(Warning, "Other candidater are:");
+				for (size_t index = 1; index < result.size(); index ++)
+					MYGUI_PLATFORM_LOG(Warning, " - '" << result[index] << "'");
+			}
+		}
+
+		return path;
+	}
+
+	void DummyDataManager::addResourceLocation(const std::string& _name, bool _recursive)
+	{
+		mIndex->addLocation(MyGUI::UString(_name).asWStr(), _recursive);
+	}
+
+	void DummyDataManager::setCheckLocationChanges(bool _value)
+	{
+		mIndex->setCheckChanges(_value);
+	}
+
+	void DummyDataManager::updateLocations()
+	{
+		mIndex->update();
 	}
 
 } // namespace MyGUI
@@ -5,6 +5,8 @@
 */
 
 #include "MyGUI_DummyRenderManager.h"
+#include "MyGUI_DummyTexture.h"
+#include "MyGUI_DummyVertexBuffer.h"
 #include "MyGUI_DummyDiagnostic.h"
 #include "MyGUI_Gui.h"
 #include "MyGUI_Timer.h"
@@ -12,38 +14,58 @@
 namespace MyGUI
 {
 
-	DummyRenderManager::DummyRenderManager()
+	DummyRenderManager::DummyRenderManager() :
+		mIsInitialise(false),
+		mLastTexture(nullptr)
 	{
 	}
 
 	void DummyRenderManager::initialise()
 	{
+		MYGUI_PLATFORM_ASSERT(!mIsInitialise, getClassTypeName() << " initialised twice");
 		MYGUI_PLATFORM_LOG(Info, "* Initialise: " << getClassTypeName());
 
 		MYGUI_PLATFORM_LOG(Info, getClassTypeName() << " successfully initialized");
+		mIsInitialise = true;
 	}
 
 	void DummyRenderManager::shutdown()
 	{
+		MYGUI_PLATFORM_ASSERT(mIsInitialise, getClassTypeName() << " is not initialised");
 		MYGUI_PLATFORM_LOG(Info, "* Shutdown: " << getClassTypeName());
 
+		destroyAllResources();
+
 		MYGUI_PLATFORM_LOG(Info, getClassTypeName() << " successfully shutdown");
+		mIsInitialise = false;
 	}
 
 	IVertexBuffer* DummyRenderManager::createVertexBuffer()
 	{
-		return nullptr;
+		return new DummyVertexBuffer();
 	}
 
 	void DummyRenderManager::destroyVertexBuffer(IVertexBuffer* _buffer)
 	{
+		delete _buffer;
 	}
 
 	void DummyRenderManager::doRender(IVertexBuffer* _buffer, ITexture* _texture, size_t _count)
 	{
+		MYGUI_PLATFORM_ASSERT(static_cast<DummyVertexBuffer*>(_buffer)->getData() != nullptr, "Vertex buffer is not created");
+
+		if (_texture != mLastTexture)
+		{
+			mLastTexture = _texture;
+			++mStatistics.textureBinds;
+		}
+
+		++mStatistics.drawCalls;
+		mStatistics.verticesRendered += _count;
+		mDrawCalls.push_back(DummyDrawCall(_texture, _count));
 	}
 
-	void DummyRenderManager::drawOneFrame()
+	void DummyRenderManager::drawOneFrame(bool _update)
 	{
 		Gui* gui = Gui::getInstancePtr();
 		if (gui == nullptr)
@@ -59,12 +81,19 @@ namespace MyGUI
 		last_time = now_time;
 
 		begin();
-		onRenderToTarget(this, false);
+		onRenderToTarget(this, _update);
 		end();
+
+		// statistics include everything since previous frame, for example texture loading
+		mLastStatistics = mStatistics;
+		mStatistics = DummyFrameStatistics();
+		mLastDrawCalls.swap(mDrawCalls);
+		mDrawCalls.clear();
 	}
 
 	void DummyRenderManager::begin()
 	{
+		mLastTexture = nullptr;
 	}
 
 	void DummyRenderManager::end()
@@ -73,27 +102,95 @@ namespace MyGUI
 
 	ITexture* DummyRenderManager::createTexture(const std::string& _name)
 	{
-		return nullptr;
+		MapTexture::const_iterator item = mTextures.find(_name);
+		MYGUI_PLATFORM_ASSERT(item == mTextures.end(), "Texture '" << _name << "' already exist");
+
+		DummyTexture* texture = new DummyTexture(_name);
+		mTextures[_name] = texture;
+		return texture;
 	}
 
 	void DummyRenderManager::destroyTexture(ITexture* _texture)
 	{
+		if (_texture == nullptr)
+			return;
+
+		MapTexture::iterator item = mTextures.find(_texture->getName());
+		MYGUI_PLATFORM_ASSERT(item != mTextures.end(), "Texture '" << _texture->getName() << "' not found");
+
+		mTextures.erase(item);
+		delete _texture;
 	}
 
 	ITexture* DummyRenderManager::getTexture(const std::string& _name)
 	{
-		return nullptr;
+		MapTexture::const_iterator item = mTextures.find(_name);
+		if (item == mTextures.end())
+			return nullptr;
+		return item->second;
 	}
 
 	bool DummyRenderManager::isFormatSupported(PixelFormat _format, TextureUsage _usage)
 	{
-		return false;
+		return
+			_format == PixelFormat::L8 ||
+			_format == PixelFormat::L8A8 ||
+			_format == PixelFormat::R8G8B8 ||
+			_format == PixelFormat::R8G8B8A8;
+	}
+
+	bool DummyRenderManager::isShaderSupported(const std::string& _shaderName)
+	{
+		// nothing is drawn, accept same shaders as OpenGL3 so that resources are prepared the same way
+		return _shaderName == "DistanceField";
 	}
 
 	void DummyRenderManager::setViewSize(int _width, int _height)
 	{
+		if (_height == 0)
+			_height = 1;
+		if (_width == 0)
+			_width = 1;
+
 		mViewSize.set(_width, _height);
+
+		mInfo.maximumDepth = 1;
+		mInfo.hOffset = 0;
+		mInfo.vOffset = 0;
+		mInfo.aspectCoef = float(mViewSize.height) / float(mViewSize.width);
+		mInfo.pixScaleX = 1.0f / float(mViewSize.width);
+		mInfo.pixScaleY = 1.0f / float(mViewSize.height);
+
 		onResizeView(mViewSize);
 	}
 
+	const DummyFrameStatistics& DummyRenderManager::getDeviceStatistics() const
+	{
+		return mLastStatistics;
+	}
+
+	const std::vector<DummyDrawCall>& DummyRenderManager::getDrawCalls() const
+	{
+		return mLastDrawCalls;
+	}
+
+	void DummyRenderManager::_notifyBytesUploaded(size_t _bytes)
+	{
+		mStatistics.bytesUploaded += _bytes;
+	}
+
+	void DummyRenderManager::_notifyVerticesUploaded(size_t _count)
+	{
+		mStatistics.verticesUploaded += _count;
+	}
+
+	void DummyRenderManager::destroyAllResources()
+	{
+		for (MapTexture::const_iterator item = mTextures.begin(); item != mTextures.end(); ++item)
+		{
+			delete item->second;
+		}
+		mTextures.clear();
+	}
+
 } // namespace MyGUI
@@ -0,0 +1,174 @@
+/*
+ * This source file is part of MyGUI. For the latest info, see http://mygui.info/
+ * Distributed under the MIT License
+ * (See accompanying file COPYING.MIT or copy at http://opensource.org/licenses/MIT)
+ */
+
+#include "MyGUI_DummyTexture.h"
+#include "MyGUI_DummyRenderManager.h"
+#include "MyGUI_DummyDiagnostic.h"
+#include "MyGUI_DataManager.h"
+#include "MyGUI_DataStreamHolder.h"
+
+namespace MyGUI
+{
+
+	DummyTexture::DummyTexture(const std::string& _name) :
+		mName(_name),
+		mWidth(0),
+		mHeight(0),
+		mPixelFormat(PixelFormat::Unknow),
+		mUsage(TextureUsage::Default),
+		mNumElemBytes(0),
+		mLock(false),
+		mWriteLock(false)
+	{
+	}
+
+	DummyTexture::~DummyTexture()
+	{
+		destroy();
+	}
+
+	const std::string& DummyTexture::getName() const
+	{
+		return mName;
+	}
+
+	void DummyTexture::createManual(int _width, int _height, TextureUsage _usage, PixelFormat _format)
+	{
+		MYGUI_PLATFORM_ASSERT(mBuffer.empty(), "Texture already exist");
+
+		if (_format == PixelFormat::L8)
+			mNumElemBytes = 1;
+		else if (_format == PixelFormat::L8A8)
+			mNumElemBytes = 2;
+		else if (_format == PixelFormat::R8G8B8)
+			mNumElemBytes = 3;
+		else if (_format == PixelFormat::R8G8B8A8)
+			mNumElemBytes = 4;
+		else
+			MYGUI_PLATFORM_EXCEPT("format not support");
+
+		mWidth = _width;
+		mHeight = _height;
+		mPixelFormat = _format;
+		mUsage = _usage;
+		mBuffer.resize(mWidth * mHeight * mNumElemBytes, 0);
+	}
+
+	void DummyTexture::loadFromFile(const std::string& _filename)
+	{
+		destroy();
+
+		int width = 0;
+		int height = 0;
+		if (!readImageSize(_filename, width, height))
+		{
+			MYGUI_PLATFORM_LOG(Warning, "Texture '" << _filename << "' size is unknown");
+			return;
+		}
+
+		createManual(width, height, TextureUsage::Static | TextureUsage::Write, PixelFormat::R8G8B8A8);
+		DummyRenderManager::getInstance()._notifyBytesUploaded(mBuffer.size());
+	}
+
+	void DummyTexture::saveToFile(const std::string& _filename)
+	{
+	}
+
+	void DummyTexture::destroy()
+	{
+		mBuffer.clear();
+		mWidth = 0;
+		mHeight = 0;
+		mNumElemBytes = 0;
+		mLock = false;
+	}
+
+	void* DummyTexture::lock(TextureUsage _access)
+	{
+		MYGUI_PLATFORM_ASSERT(!mBuffer.empty(), "Texture is not created");
+
+		mLock = true;
+		mWriteLock = _access.isValue(TextureUsage::Write);
+		return &mBuffer[0];
+	}
+
+	void DummyTexture::unlock()
+	{
+		MYGUI_PLATFORM_ASSERT(mLock, "Texture is not locked");
+
+		if (mWriteLock)
+			DummyRenderManager::getInstance()._notifyBytesUploaded(mBuffer.size());
+		mLock = false;
+		mWriteLock = false;
+	}
+
+	bool DummyTexture::updateRegion(const IntCoord& _coord, const void* _data)
+	{
+		MYGUI_PLATFORM_ASSERT(!mBuffer.empty(), "Texture is not created");
+
+		const uint8* source = static_cast<const uint8*>(_data);
+		size_t rowSize = _coord.width * mNumElemBytes;
+		for (int y = _coord.top; y < _coord.bottom(); ++y)
+		{
+			size_t offset = (y * mWidth + _coord.left) * mNumElemBytes;
+			memcpy(&mBuffer[offset], source + offset, rowSize);
+		}
+
+		DummyRenderManager::getInstance()._notifyBytesUploaded(rowSize * _coord.height);
+		return true;
+	}
+
+	bool DummyTexture::isLocked()
+	{
+		return mLock;
+	}
+
+	int DummyTexture::getWidth()
+	{
+		return mWidth;
+	}
+
+	int DummyTexture::getHeight()
+	{
+		return mHeight;
+	}
+
+	PixelFormat DummyTexture::getFormat()
+	{
+		return mPixelFormat;
+	}
+
+	TextureUsage DummyTexture::getUsage()
+	{
+		return mUsage;
+	}
+
+	size_t DummyTexture::getNumElemBytes()
+	{
+		return mNumElemBytes;
+	}
+
+	bool DummyTexture::readImageSize(const std::string& _filename, int& _width, int& _height)
+	{
+		DataStreamHolder data = DataManager::getInstance().getData(_filename);
+		if (data.getData() == nullptr)
+			return false;
+
+		// PNG signature followed by IHDR chunk with big endian width and height
+		unsigned char header[24];
+		if (data.getData()->read(header, sizeof(header)) != sizeof(header))
+			return false;
+
+		const unsigned char signature[8] = { 0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n' };
+		if (memcmp(header, signature, sizeof(signature)) != 0 || memcmp(header + 12, "IHDR", 4) != 0)
+			return false;
+
+		_width = (header[16] << 24) | (header[17] << 16) | (header[18] << 8) | header[19];
+		_height = (header[20] << 24) | (header[21] << 16) | (header[22] << 8) | header[23];
+		return _width > 0 && _height > 0;
+	}
+
+} // namespace MyGUI
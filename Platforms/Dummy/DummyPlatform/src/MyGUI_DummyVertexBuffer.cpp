@@ -0,0 +1,70 @@
+/*
+ * This source file is part of MyGUI. For the latest info, see http://mygui.info/
+ * Distributed under the MIT License
+ * (See accompanying file COPYING.MIT or copy at http://opensource.org/licenses/MIT)
+ */
+
+#include "MyGUI_DummyVertexBuffer.h"
+#include "MyGUI_DummyRenderManager.h"
+#include "MyGUI_DummyDiagnostic.h"
+
+namespace MyGUI
+{
+
+	DummyVertexBuffer::DummyVertexBuffer() :
+		mNeedVertexCount(0),
+		mLockedCount(0)
+	{
+	}
+
+	DummyVertexBuffer::~DummyVertexBuffer()
+	{
+	}
+
+	void DummyVertexBuffer::setVertexCount(size_t _count)
+	{
+		// buffer is reallocated on lock, only if it's capacity is not suitable
+		mNeedVertexCount = _count;
+	}
+
+	size_t DummyVertexBuffer::getVertexCount()
+	{
+		return mNeedVertexCount;
+	}
+
+	bool DummyVertexBuffer::checkShrink()
+	{
+		return mCapacity.checkShrink(mNeedVertexCount);
+	}
+
+	Vertex* DummyVertexBuffer::lock()
+	{
+		if (mCapacity.update(mNeedVertexCount))
+			mBuffer.resize(mCapacity.getCapacity());
+
+		mLockedCount = mNeedVertexCount;
+		return &mBuffer[0];
+	}
+
+	Vertex* DummyVertexBuffer::lockRange(size_t _start, size_t _count)
+	{
+		MYGUI_PLATFORM_ASSERT(_start + _count <= mBuffer.size(), "Vertex buffer range is out of bounds");
+
+		mLockedCount = _count;
+		return &mBuffer[_start];
+	}
+
+	void DummyVertexBuffer::unlock()
+	{
+		DummyRenderManager& render = DummyRenderManager::getInstance();
+		render._notifyVerticesUploaded(mLockedCount);
+		render._notifyBytesUploaded(mLockedCount * sizeof(Vertex));
+		mLockedCount = 0;
+	}
+
+	const Vertex* DummyVertexBuffer::getData() const
+	{
+		return mBuffer.empty() ? nullptr : &mBuffer[0];
+	}
+
+} // namespace MyGUI
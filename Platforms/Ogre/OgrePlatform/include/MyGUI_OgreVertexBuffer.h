@@ -9,6 +9,7 @@
 
 #include "MyGUI_Prerequest.h"
 #include "MyGUI_IVertexBuffer.h"
+#include "MyGUI_VertexBufferCapacity.h"
 
 #include <OgreHardwareBufferManager.h>
 #include <OgreHardwareVertexBuffer.h>
@@ -35,6 +36,7 @@ namespace MyGUI
 
 		virtual Vertex* lock();
 		virtual void unlock();
+		virtual bool checkShrink();
 
 		Ogre::RenderOperation* getRenderOperation()
 		{
@@ -47,7 +49,7 @@ namespace MyGUI
 		void resizeVertexBuffer();
 
 	private:
-		size_t mVertexCount;
+		VertexBufferCapacity mCapacity;
 		size_t mNeedVertexCount;
 
 		Ogre::RenderOperation mRenderOperation;
@@ -13,13 +13,10 @@
 namespace MyGUI
 {
 
-	const size_t VERTEX_IN_QUAD = 6;
-	const size_t RENDER_ITEM_STEEP_REALLOCK = 5 * VERTEX_IN_QUAD;
-
 	OgreVertexBuffer::OgreVertexBuffer() :
-		mVertexCount(RENDER_ITEM_STEEP_REALLOCK),
 		mNeedVertexCount(0)
 	{
+		mCapacity.update(mNeedVertexCount);
 		createVertexBuffer();
 	}
 
@@ -43,7 +40,7 @@ namespace MyGUI
 		// Create the Vertex Buffer, using the Vertex Structure we previously declared in _declareVertexStructure.
 		mVertexBuffer = Ogre::HardwareBufferManager::getSingleton( ).createVertexBuffer(
 			mRenderOperation.vertexData->vertexDeclaration->getVertexSize(0), // declared Vertex used
-			mVertexCount,
+			mCapacity.getCapacity(),
 			Ogre::HardwareBuffer::HBU_DYNAMIC_WRITE_ONLY_DISCARDABLE,
 			false );
 
@@ -62,7 +59,6 @@ namespace MyGUI
 
 	void OgreVertexBuffer::resizeVertexBuffer()
 	{
-		mVertexCount = mNeedVertexCount + RENDER_ITEM_STEEP_REALLOCK;
 		destroyVertexBuffer();
 		createVertexBuffer();
 	}
@@ -77,9 +73,14 @@ namespace MyGUI
 		return mNeedVertexCount;
 	}
 
+	bool OgreVertexBuffer::checkShrink()
+	{
+		return mCapacity.checkShrink(mNeedVertexCount);
+	}
+
 	Vertex* OgreVertexBuffer::lock()
 	{
-		if (mNeedVertexCount > mVertexCount) resizeVertexBuffer();
+		if (mCapacity.update(mNeedVertexCount)) resizeVertexBuffer();
 
 		return reinterpret_cast<Vertex*>(mVertexBuffer->lock(Ogre::HardwareVertexBuffer::HBL_DISCARD));
 	}
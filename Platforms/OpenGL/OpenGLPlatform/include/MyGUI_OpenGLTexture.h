@@ -37,6 +37,7 @@ namespace MyGUI
 		virtual void* lock(TextureUsage _access);
 		virtual void unlock();
 		virtual bool isLocked();
+		virtual bool updateRegion(const IntCoord& _coord, const void* _data);
 
 		virtual PixelFormat getFormat();
 		virtual TextureUsage getUsage();
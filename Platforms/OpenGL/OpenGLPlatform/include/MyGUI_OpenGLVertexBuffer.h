@@ -9,6 +9,8 @@
 
 #include "MyGUI_Prerequest.h"
 #include "MyGUI_IVertexBuffer.h"
+#include "MyGUI_VertexBufferCapacity.h"
+#include <vector>
 //#include "MyGUI_OpenGLRenderManager.h"
 
 namespace MyGUI
@@ -25,6 +27,9 @@ namespace MyGUI
 
 		virtual Vertex* lock();
 		virtual void unlock();
+		virtual bool checkShrink();
+
+		virtual Vertex* lockRange(size_t _start, size_t _count);
 
 	/*internal:*/
 		void destroy();
@@ -37,9 +42,13 @@ namespace MyGUI
 
 	private:
 		unsigned int mBufferID;
-        //size_t mVertexCount;
+		VertexBufferCapacity mCapacity;
 		size_t mNeedVertexCount;
 		size_t mSizeInBytes;
+		// changed range, uploaded on unlock
+		std::vector<Vertex> mRangeBuffer;
+		size_t mRangeStart;
+		size_t mRangeCount;
 	};
 
 } // namespace MyGUI
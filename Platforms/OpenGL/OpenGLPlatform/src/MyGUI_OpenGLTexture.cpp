@@ -323,6 +323,30 @@ namespace MyGUI
 		mLock = false;
 	}
 
+	bool OpenGLTexture::updateRegion(const IntCoord& _coord, const void* _data)
+	{
+		MYGUI_PLATFORM_ASSERT(mTextureID, "Texture is not created");
+
+		// Read only rectangle from image of whole texture
+		int alignment = 0;
+		glGetIntegerv(GL_UNPACK_ALIGNMENT, &alignment);
+		glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+		glPixelStorei(GL_UNPACK_ROW_LENGTH, mWidth);
+		glPixelStorei(GL_UNPACK_SKIP_PIXELS, _coord.left);
+		glPixelStorei(GL_UNPACK_SKIP_ROWS, _coord.top);
+
+		glBindTexture(GL_TEXTURE_2D, mTextureID);
+		glTexSubImage2D(GL_TEXTURE_2D, 0, _coord.left, _coord.top, _coord.width, _coord.height, mPixelFormat, GL_UNSIGNED_BYTE, _data);
+		glBindTexture(GL_TEXTURE_2D, 0);
+
+		glPixelStorei(GL_UNPACK_SKIP_ROWS, 0);
+		glPixelStorei(GL_UNPACK_SKIP_PIXELS, 0);
+		glPixelStorei(GL_UNPACK_ROW_LENGTH, 0);
+		glPixelStorei(GL_UNPACK_ALIGNMENT, alignment);
+
+		return true;
+	}
+
 	void OpenGLTexture::loadFromFile(const std::string& _filename)
 	{
 		destroy();
@@ -13,14 +13,12 @@
 namespace MyGUI
 {
 
-    //const size_t VERTEX_IN_QUAD = 6;
-    //const size_t RENDER_ITEM_STEEP_REALLOCK = 5 * VERTEX_IN_QUAD;
-
 	OpenGLVertexBuffer::OpenGLVertexBuffer() :
         mBufferID(0),
-        //mVertexCount(RENDER_ITEM_STEEP_REALLOCK),
         mNeedVertexCount(0),
-		mSizeInBytes(0)
+		mSizeInBytes(0),
+		mRangeStart(0),
+		mRangeCount(0)
 	{
 	}
 
@@ -31,12 +29,8 @@ namespace MyGUI
 
 	void OpenGLVertexBuffer::setVertexCount(size_t _count)
 	{
-		if (_count != mNeedVertexCount)
-		{
-			mNeedVertexCount = _count;
-			destroy();
-			create();
-		}
+		// buffer is reallocated on lock, only if it's capacity is not suitable
+		mNeedVertexCount = _count;
 	}
 
 	size_t OpenGLVertexBuffer::getVertexCount()
@@ -44,8 +38,19 @@ namespace MyGUI
 		return mNeedVertexCount;
 	}
 
+	bool OpenGLVertexBuffer::checkShrink()
+	{
+		return mCapacity.checkShrink(mNeedVertexCount);
+	}
+
 	Vertex* OpenGLVertexBuffer::lock()
 	{
+		if (mCapacity.update(mNeedVertexCount))
+		{
+			destroy();
+			create();
+		}
+
 		MYGUI_PLATFORM_ASSERT(mBufferID, "Vertex buffer in not created");
 
 		// Use glMapBuffer
@@ -64,11 +69,35 @@ namespace MyGUI
 		return pBuffer;
 	}
 
+	Vertex* OpenGLVertexBuffer::lockRange(size_t _start, size_t _count)
+	{
+		MYGUI_PLATFORM_ASSERT(mBufferID, "Vertex buffer in not created");
+
+		// buffer drawn last frame can't be mapped without waiting for GPU and rest of its content is still in use,
+		// so range is written to memory and uploaded with glBufferSubData on unlock
+		if (_count == 0)
+			return nullptr;
+
+		mRangeBuffer.resize(_count);
+		mRangeStart = _start;
+		mRangeCount = _count;
+		return &mRangeBuffer[0];
+	}
+
 	void OpenGLVertexBuffer::unlock()
 	{
 		MYGUI_PLATFORM_ASSERT(mBufferID, "Vertex buffer in not created");
 
 		glBindBuffer(GL_ARRAY_BUFFER, mBufferID);
+
+		if (mRangeCount != 0)
+		{
+			glBufferSubData(GL_ARRAY_BUFFER, mRangeStart * sizeof(Vertex), mRangeCount * sizeof(Vertex), &mRangeBuffer[0]);
+			glBindBuffer(GL_ARRAY_BUFFER, 0);
+			mRangeCount = 0;
+			return;
+		}
+
 		GLboolean result = glUnmapBuffer(GL_ARRAY_BUFFER);
 		glBindBuffer(GL_ARRAY_BUFFER, 0);
 
@@ -88,7 +117,7 @@ namespace MyGUI
 	{
 		MYGUI_PLATFORM_ASSERT(!mBufferID, "Vertex buffer already exist");
 
-		mSizeInBytes = mNeedVertexCount * sizeof(MyGUI::Vertex);
+		mSizeInBytes = mCapacity.getCapacity() * sizeof(MyGUI::Vertex);
 		void* data = 0;
 
 		glGenBuffers(1, &mBufferID);
@@ -10,6 +10,11 @@
 #include "MyGUI_Prerequest.h"
 #include "MyGUI_DataManager.h"
 
+namespace common
+{
+	class DataFileIndex;
+}
+
 namespace MyGUI
 {
 
@@ -18,6 +23,7 @@ namespace MyGUI
 	{
 	public:
 		OpenGL3DataManager();
+		virtual ~OpenGL3DataManager();
 
 		void initialise();
 		void shutdown();
@@ -46,17 +52,18 @@ namespace MyGUI
 		/** @see DataManager::getDataPath(const std::string& _name) */
 		virtual const std::string& getDataPath(const std::string& _name);
 
+		/** Enable or disable checking resource locations for added, removed or renamed files before each search.
+			Files of locations are indexed once when location is added, instead of scanning folders on every search.
+			Disabled by default, then locations are checked only when file is not found, so added files are found
+			but removed or renamed files are still reported until next check.
+		*/
+		void setCheckLocationChanges(bool _value);
+
 	/*internal:*/
 		void addResourceLocation(const std::string& _name, bool _recursive);
 
 	private:
-		struct ArhivInfo
-		{
-			std::wstring name;
-			bool recursive;
-		};
-		typedef std::vector<ArhivInfo> VectorArhivInfo;
-		VectorArhivInfo mPaths;
+		common::DataFileIndex* mIndex;
 
 		bool mIsInitialise;
 	};
@@ -12,6 +12,7 @@
 #include "MyGUI_IVertexBuffer.h"
 #include "MyGUI_RenderManager.h"
 #include "MyGUI_OpenGL3ImageLoader.h"
+#include <vector>
 
 namespace MyGUI
 {
@@ -38,6 +39,9 @@ namespace MyGUI
 		/** @see OpenGL3RenderManager::isFormatSupported */
 		virtual bool isFormatSupported(PixelFormat _format, TextureUsage _usage);
 
+		/** @see OpenGL3RenderManager::isShaderSupported */
+		virtual bool isShaderSupported(const std::string& _shaderName);
+
 		/** @see OpenGL3RenderManager::createVertexBuffer */
 		virtual IVertexBuffer* createVertexBuffer();
 		/** @see OpenGL3RenderManager::destroyVertexBuffer */
@@ -63,14 +67,39 @@ namespace MyGUI
     /* for use with RTT, flips Y coordinate when rendering */
     void doRenderRTT(IVertexBuffer* _buffer, ITexture* _texture, size_t _count); 
 
+		/** Enable frame streaming arena for vertex buffers created after this call.
+			Streaming vertex buffers are kept in memory and all draws between begin and end
+			are uploaded into one shared ring buffer with a single map/unmap.
+			Consecutive draws with the same texture are merged into one draw call,
+			across layer node and layer boundaries.
+		*/
+		void setVertexStreaming(bool _value);
+		/** Is frame streaming arena enabled */
+		bool getVertexStreaming() const;
+
+		/** Set how many textures one streamed draw call can use (1 - 8, 1 by default).
+			With more than one slot vertices get texture slot index and draws with
+			different textures are batched together while draw order is preserved.
+		*/
+		void setTextureSlotCount(size_t _value);
+		/** Get how many textures one streamed draw call can use */
+		size_t getTextureSlotCount() const;
+
 	/*internal:*/
 		void drawOneFrame();
 		void setViewSize(int _width, int _height);
 		bool isPixelBufferObjectSupported() const;
     unsigned int createShaderProgram(void);
+    unsigned int createMultiTextureShaderProgram(void);
+    unsigned int createDistanceFieldShaderProgram(void);
+		/** Upload and draw everything that was queued in streaming arena */
+		void _flushVertexStream();
 
 	private:
 		void destroyAllResources();
+		void destroyVertexStream();
+		void queueStreamDraw(const Vertex* _data, size_t _count, unsigned int _textureID, bool _distanceField);
+		void prepareDistanceFieldProgram();
 
 	private:
 		IntSize mViewSize;
@@ -87,6 +116,33 @@ namespace MyGUI
 		bool mPboIsSupported;
         
 		bool mIsInitialise;
+
+		enum { MaxTextureSlots = 8 };
+
+		struct StreamDraw
+		{
+			unsigned int textureIDs[MaxTextureSlots];
+			size_t textureCount;
+			size_t first;
+			size_t count;
+			float yScale;
+			bool distanceField;
+		};
+
+		bool mVertexStreaming;
+		unsigned int mStreamBufferID;
+		unsigned int mStreamVAOID;
+		size_t mStreamCapacity;
+		size_t mStreamOffset;
+		float mYScale;
+		size_t mTextureSlotCount;
+		unsigned int mMultiTextureProgramID;
+		int mMultiTextureYScaleUniformLocation;
+		unsigned int mDistanceFieldProgramID;
+		int mDistanceFieldYScaleUniformLocation;
+		std::vector<Vertex> mStreamVertices;
+		std::vector<float> mStreamSlots;
+		std::vector<StreamDraw> mStreamDraws;
   };
 
 } // namespace MyGUI
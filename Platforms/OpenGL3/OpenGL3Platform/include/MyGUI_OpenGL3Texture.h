@@ -37,6 +37,7 @@ namespace MyGUI
 		virtual void* lock(TextureUsage _access);
 		virtual void unlock();
 		virtual bool isLocked();
+		virtual bool updateRegion(const IntCoord& _coord, const void* _data);
 
 		virtual PixelFormat getFormat();
 		virtual TextureUsage getUsage();
@@ -44,8 +45,11 @@ namespace MyGUI
 
 		virtual IRenderTarget* getRenderTarget();
 
+		virtual void setShader(const std::string& _shaderName);
+
 	/*internal:*/
 		unsigned int getTextureID() const;
+		bool getDistanceField() const;
 		void setUsage(TextureUsage _usage);
 		void createManual(int _width, int _height, TextureUsage _usage, PixelFormat _format, void* _data);
 
@@ -70,6 +74,7 @@ namespace MyGUI
 		TextureUsage mOriginalUsage;
 		OpenGL3ImageLoader* mImageLoader;
 		OpenGL3RTTexture* mRenderTarget;
+		bool mDistanceField;
 	};
 
 } // namespace MyGUI
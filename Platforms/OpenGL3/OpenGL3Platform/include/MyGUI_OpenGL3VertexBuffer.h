@@ -9,6 +9,8 @@
 
 #include "MyGUI_Prerequest.h"
 #include "MyGUI_IVertexBuffer.h"
+#include "MyGUI_VertexBufferCapacity.h"
+#include <vector>
 //#include "MyGUI_OpenGL3RenderManager.h"
 
 namespace MyGUI
@@ -17,7 +19,7 @@ namespace MyGUI
 	class OpenGL3VertexBuffer : public IVertexBuffer
 	{
 	public:
-		OpenGL3VertexBuffer();
+		OpenGL3VertexBuffer(bool _streaming = false);
 		virtual ~OpenGL3VertexBuffer();
 
 		virtual void setVertexCount(size_t _count);
@@ -25,6 +27,9 @@ namespace MyGUI
 
 		virtual Vertex* lock();
 		virtual void unlock();
+		virtual bool checkShrink();
+
+		virtual Vertex* lockRange(size_t _start, size_t _count);
 
 	/*internal:*/
 		void destroy();
@@ -35,12 +40,29 @@ namespace MyGUI
 			return mVAOID;
 		}
 
+		// streaming buffers keep vertices in memory, they are uploaded by OpenGL3RenderManager
+		bool isStreaming() const
+		{
+			return mStreaming;
+		}
+
+		const Vertex* getStreamData() const
+		{
+			return mShadowBuffer.empty() ? nullptr : &mShadowBuffer[0];
+		}
+
 	private:
     unsigned int mVAOID;
     unsigned int mBufferID;
-        //size_t mVertexCount;
+		VertexBufferCapacity mCapacity;
 		size_t mNeedVertexCount;
 		size_t mSizeInBytes;
+		// changed range, uploaded on unlock
+		std::vector<Vertex> mRangeBuffer;
+		size_t mRangeStart;
+		size_t mRangeCount;
+		bool mStreaming;
+		std::vector<Vertex> mShadowBuffer;
 	};
 
 } // namespace MyGUI
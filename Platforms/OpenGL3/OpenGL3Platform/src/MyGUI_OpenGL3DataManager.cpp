@@ -7,17 +7,23 @@
 #include "MyGUI_OpenGL3DataManager.h"
 #include "MyGUI_OpenGL3Diagnostic.h"
 #include "MyGUI_DataFileStream.h"
-#include "FileSystemInfo/FileSystemInfo.h"
+#include "FileSystemInfo/DataFileIndex.h"
 #include <fstream>
 
 namespace MyGUI
 {
 
 	OpenGL3DataManager::OpenGL3DataManager() :
+		mIndex(new common::DataFileIndex()),
 		mIsInitialise(false)
 	{
 	}
 
+	OpenGL3DataManager::~OpenGL3DataManager()
+	{
+		delete mIndex;
+	}
+
 	void OpenGL3DataManager::initialise()
 	{
 		MYGUI_PLATFORM_ASSERT(!mIsInitialise, getClassTypeName() << " initialised twice");
@@ -73,10 +79,7 @@ namespace MyGUI
 		common::VectorWString wresult;
 		result.clear();
 
-		for (VectorArhivInfo::const_iterator item = mPaths.begin(); item != mPaths.end(); ++item)
-		{
-			common::scanFolder(wresult, (*item).name, (*item).recursive, MyGUI::UString(_pattern).asWStr(), false);
-		}
+		mIndex->scan(wresult, MyGUI::UString(_pattern).asWStr(), false);
 
 		for (common::VectorWString::const_iterator item = wresult.begin(); item != wresult.end(); ++item)
 		{
@@ -91,11 +94,9 @@ namespace MyGUI
 		static std::string path;
 		VectorString result;
 		common::VectorWString wresult;
+		path.clear();
 
-		for (VectorArhivInfo::const_iterator item = mPaths.begin(); item != mPaths.end(); ++item)
-		{
-			common::scanFolder(wresult, (*item).name, (*item).recursive, MyGUI::UString(_name).asWStr(), true);
-		}
+		mIndex->scan(wresult, MyGUI::UString(_name).asWStr(), true);
 
 		for (common::VectorWString::const_iterator item = wresult.begin(); item != wresult.end(); ++item)
 		{
@@ -119,10 +120,12 @@ namespace MyGUI
 
 	void OpenGL3DataManager::addResourceLocation(const std::string& _name, bool _recursive)
 	{
-		ArhivInfo info;
-		info.name = MyGUI::UString(_name).asWStr();
-		info.recursive = _recursive;
-		mPaths.push_back(info);
+		mIndex->addLocation(MyGUI::UString(_name).asWStr(), _recursive);
+	}
+
+	void OpenGL3DataManager::setCheckLocationChanges(bool _value)
+	{
+		mIndex->setCheckChanges(_value);
 	}
 
 } // namespace MyGUI
@@ -73,6 +73,9 @@ namespace MyGUI
 
 	void OpenGL3RTTexture::begin()
 	{
+    // draws queued for previous target must be done before target switch
+    OpenGL3RenderManager::getInstance()._flushVertexStream();
+
     glGetIntegerv(GL_VIEWPORT, mSavedViewport); // save current viewport
     
     glBindFramebufferEXT(GL_FRAMEBUFFER_EXT, mFBOID);
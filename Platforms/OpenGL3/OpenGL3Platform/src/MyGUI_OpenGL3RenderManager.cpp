@@ -14,6 +14,9 @@
 
 #include "GL/glew.h"
 
+#include <algorithm>
+#include <cstring>
+
 namespace MyGUI
 {
 
@@ -31,7 +34,18 @@ namespace MyGUI
 		mUpdate(false),
 		mImageLoader(nullptr),
 		mPboIsSupported(false),
-		mIsInitialise(false)
+		mIsInitialise(false),
+		mVertexStreaming(false),
+		mStreamBufferID(0),
+		mStreamVAOID(0),
+		mStreamCapacity(0),
+		mStreamOffset(0),
+		mYScale(1.0f),
+		mTextureSlotCount(1),
+		mMultiTextureProgramID(0),
+		mMultiTextureYScaleUniformLocation(-1),
+		mDistanceFieldProgramID(0),
+		mDistanceFieldYScaleUniformLocation(-1)
 	{
 	}
 
@@ -60,6 +74,45 @@ namespace MyGUI
     return id;
   }
 
+  GLuint linkShaderProgram(const char* vertexShader, const char* fragmentShader, bool slotAttribute)
+  {
+    GLuint vsID = buildShader(vertexShader, GL_VERTEX_SHADER);
+    GLuint fsID = buildShader(fragmentShader, GL_FRAGMENT_SHADER);
+
+    GLuint progID = glCreateProgram();
+    glAttachShader(progID, vsID);
+    glAttachShader(progID, fsID);
+
+    // setup vertex attribute positions for vertex buffer
+    glBindAttribLocation(progID, 0, "VertexPosition");
+    glBindAttribLocation(progID, 1, "VertexColor");
+    glBindAttribLocation(progID, 2, "VertexTexCoord");
+    if (slotAttribute)
+      glBindAttribLocation(progID, 3, "VertexSlot");
+    glBindFragDataLocation(progID, 0, "FragColor");
+
+    glLinkProgram(progID);
+
+    GLint success;
+    glGetProgramiv(progID, GL_LINK_STATUS, &success);
+
+    if (success == GL_FALSE) {
+      GLint len = 0;
+      glGetProgramiv(progID, GL_INFO_LOG_LENGTH, &len);
+
+      GLchar* buffer = new GLchar[len];
+      glGetProgramInfoLog(progID, len, NULL, buffer);
+      std::string infoLog = buffer;
+      delete[] buffer;
+
+      MYGUI_PLATFORM_EXCEPT(infoLog);
+    }
+    glDeleteShader(vsID); // flag for deletion on call to glDeleteProgram
+    glDeleteShader(fsID);
+
+    return progID;
+  }
+
   GLuint OpenGL3RenderManager::createShaderProgram(void)
   {
     const char vertexShader[] =
@@ -92,49 +145,144 @@ namespace MyGUI
       "}\n"
       ;
 
-    GLuint vsID = buildShader(vertexShader, GL_VERTEX_SHADER);
-    GLuint fsID = buildShader(fragmentShader, GL_FRAGMENT_SHADER);
+    GLuint progID = linkShaderProgram(vertexShader, fragmentShader, false);
 
-    GLuint progID = glCreateProgram();
-    glAttachShader(progID, vsID);
-    glAttachShader(progID, fsID);
-
-    // setup vertex attribute positions for vertex buffer
-    glBindAttribLocation(progID, 0, "VertexPosition");
-    glBindAttribLocation(progID, 1, "VertexColor");
-    glBindAttribLocation(progID, 2, "VertexTexCoord");
-    glBindFragDataLocation(progID, 0, "FragColor");
+    int textureUniLoc = glGetUniformLocation(progID, "Texture");
+    if (textureUniLoc == -1) {
+      MYGUI_PLATFORM_EXCEPT("Unable to retrieve uniform variable location");
+    }
+    mYScaleUniformLocation = glGetUniformLocation(progID, "YScale");
+    if (mYScaleUniformLocation == -1) {
+      MYGUI_PLATFORM_EXCEPT("Unable to retrieve YScale variable location");
+    }
+    glUseProgram(progID);
+    glUniform1i(textureUniLoc, 0); // set active sampler for 'Texture' to GL_TEXTURE0
+    glUniform1f(mYScaleUniformLocation, 1.0f);
+    glUseProgram(0);
 
-    glLinkProgram(progID);
+    return progID;
+  }
 
-    GLint success;
-    glGetProgramiv(progID, GL_LINK_STATUS, &success);
+  GLuint OpenGL3RenderManager::createMultiTextureShaderProgram(void)
+  {
+    // same as default program, but texture is selected by per vertex slot index
+    const char vertexShader[] =
+      "#version 130\n"
+      "out vec4 Color;\n"
+      "out vec2 TexCoord;\n"
+      "flat out int Slot;\n"
+      "in vec3 VertexPosition;\n"
+      "in vec4 VertexColor;\n"
+      "in vec2 VertexTexCoord;\n"
+      "in float VertexSlot;\n"
+      "uniform float YScale;\n"
+      "void main()\n"
+      "{\n"
+      "  TexCoord = VertexTexCoord;\n"
+      "  Color = VertexColor;\n"
+      "  Slot = int(VertexSlot + 0.5);\n"
+      "  vec4 vpos = vec4(VertexPosition,1.0);\n"
+      "  vpos.y *= YScale;\n"
+      "  gl_Position = vpos;\n"
+      "}\n"
+      ;
 
-    if (success == GL_FALSE) {
-      GLint len = 0;
-      glGetProgramiv(progID, GL_INFO_LOG_LENGTH, &len);
+    // samplers can be indexed only by constant expressions in GLSL 1.30
+    const char fragmentShader[] =
+      "#version 130\n"
+      "in vec4 Color; \n"
+      "in vec2 TexCoord;\n"
+      "flat in int Slot;\n"
+      "out vec4 FragColor;\n"
+      "uniform sampler2D Textures[8];\n"
+      "void main(void)\n"
+      "{\n"
+      "  vec4 texel;\n"
+      "  if (Slot == 0) texel = texture2D(Textures[0], TexCoord);\n"
+      "  else if (Slot == 1) texel = texture2D(Textures[1], TexCoord);\n"
+      "  else if (Slot == 2) texel = texture2D(Textures[2], TexCoord);\n"
+      "  else if (Slot == 3) texel = texture2D(Textures[3], TexCoord);\n"
+      "  else if (Slot == 4) texel = texture2D(Textures[4], TexCoord);\n"
+      "  else if (Slot == 5) texel = texture2D(Textures[5], TexCoord);\n"
+      "  else if (Slot == 6) texel = texture2D(Textures[6], TexCoord);\n"
+      "  else texel = texture2D(Textures[7], TexCoord);\n"
+      "  FragColor = texel * Color;\n"
+      "}\n"
+      ;
 
-      GLchar* buffer = new GLchar[len];
-      glGetProgramInfoLog(progID, len, NULL, buffer);
-      std::string infoLog = buffer;
-      delete[] buffer;
+    GLuint progID = linkShaderProgram(vertexShader, fragmentShader, true);
 
-      MYGUI_PLATFORM_EXCEPT(infoLog);
+    int texturesUniLoc = glGetUniformLocation(progID, "Textures");
+    if (texturesUniLoc == -1) {
+      MYGUI_PLATFORM_EXCEPT("Unable to retrieve uniform variable location");
     }
-    glDeleteShader(vsID); // flag for deletion on call to glDeleteProgram
-    glDeleteShader(fsID);
+    mMultiTextureYScaleUniformLocation = glGetUniformLocation(progID, "YScale");
+    if (mMultiTextureYScaleUniformLocation == -1) {
+      MYGUI_PLATFORM_EXCEPT("Unable to retrieve YScale variable location");
+    }
+
+    GLint units[MaxTextureSlots];
+    for (int index = 0; index < MaxTextureSlots; ++index)
+      units[index] = index;
+
+    glUseProgram(progID);
+    glUniform1iv(texturesUniLoc, MaxTextureSlots, units);
+    glUniform1f(mMultiTextureYScaleUniformLocation, 1.0f);
+
+    return progID;
+  }
+
+  GLuint OpenGL3RenderManager::createDistanceFieldShaderProgram(void)
+  {
+    const char vertexShader[] =
+      "#version 130\n"
+      "out vec4 Color;\n"
+      "out vec2 TexCoord;\n"
+      "in vec3 VertexPosition;\n"
+      "in vec4 VertexColor;\n"
+      "in vec2 VertexTexCoord;\n"
+      "uniform float YScale;\n"
+      "void main()\n"
+      "{\n"
+      "  TexCoord = VertexTexCoord;\n"
+      "  Color = VertexColor;\n"
+      "  vec4 vpos = vec4(VertexPosition,1.0);\n"
+      "  vpos.y *= YScale;\n"
+      "  gl_Position = vpos;\n"
+      "}\n"
+      ;
+
+    // alpha of green pixels is distance to glyph outline (0.5 on outline), grey pixels
+    // (cursor and selection glyphs) are drawn as usual, edge is antialiased over one screen pixel
+    const char fragmentShader[] =
+      "#version 130\n"
+      "in vec4 Color; \n"
+      "in vec2 TexCoord;\n"
+      "out vec4 FragColor;\n"
+      "uniform sampler2D Texture;\n"
+      "void main(void)\n"
+      "{\n"
+      "  vec4 texel = texture2D(Texture, TexCoord);\n"
+      "  float distanceField = clamp(texel.g - texel.r, 0.0, 1.0);\n"
+      "  float width = max(0.5 * fwidth(texel.a), 0.001);\n"
+      "  float alpha = smoothstep(0.5 - width, 0.5 + width, texel.a);\n"
+      "  FragColor = vec4(mix(texel.rgb, vec3(1.0), distanceField), mix(texel.a, alpha, distanceField)) * Color;\n"
+      "}\n"
+      ;
+
+    GLuint progID = linkShaderProgram(vertexShader, fragmentShader, false);
 
     int textureUniLoc = glGetUniformLocation(progID, "Texture");
     if (textureUniLoc == -1) {
       MYGUI_PLATFORM_EXCEPT("Unable to retrieve uniform variable location");
     }
-    mYScaleUniformLocation = glGetUniformLocation(progID, "YScale");
-    if (mYScaleUniformLocation == -1) {
+    mDistanceFieldYScaleUniformLocation = glGetUniformLocation(progID, "YScale");
+    if (mDistanceFieldYScaleUniformLocation == -1) {
       MYGUI_PLATFORM_EXCEPT("Unable to retrieve YScale variable location");
     }
     glUseProgram(progID);
-    glUniform1i(textureUniLoc, 0); // set active sampler for 'Texture' to GL_TEXTURE0
-    glUniform1f(mYScaleUniformLocation, 1.0f);
+    glUniform1i(textureUniLoc, 0);
+    glUniform1f(mDistanceFieldYScaleUniformLocation, 1.0f);
     glUseProgram(0);
 
     return progID;
@@ -180,7 +328,7 @@ namespace MyGUI
 
 	IVertexBuffer* OpenGL3RenderManager::createVertexBuffer()
 	{
-		return new OpenGL3VertexBuffer();
+		return new OpenGL3VertexBuffer(mVertexStreaming);
 	}
 
 	void OpenGL3RenderManager::destroyVertexBuffer(IVertexBuffer* _buffer)
@@ -190,25 +338,51 @@ namespace MyGUI
 
   void OpenGL3RenderManager::doRenderRTT(IVertexBuffer* _buffer, ITexture* _texture, size_t _count)
   {
+    mYScale = -1.0f;
     glUniform1f(mYScaleUniformLocation, -1.0f);
     doRender(_buffer, _texture, _count);
     glUniform1f(mYScaleUniformLocation, 1.0f);
+    mYScale = 1.0f;
   }
 
 	void OpenGL3RenderManager::doRender(IVertexBuffer* _buffer, ITexture* _texture, size_t _count)
 	{
     OpenGL3VertexBuffer* buffer = static_cast<OpenGL3VertexBuffer*>(_buffer);
-		unsigned int buffer_id = buffer->getBufferID();
-		MYGUI_PLATFORM_ASSERT(buffer_id, "Vertex buffer is not created");
 
 		unsigned int texture_id = 0;
+		bool distanceField = false;
 		if (_texture)
 		{
 			OpenGL3Texture* texture = static_cast<OpenGL3Texture*>(_texture);
 			texture_id = texture->getTextureID();
+			distanceField = texture->getDistanceField();
 			//MYGUI_PLATFORM_ASSERT(texture_id, "Texture is not created");
 		}
 
+		if (distanceField)
+			prepareDistanceFieldProgram();
+
+		if (buffer->isStreaming())
+		{
+			const Vertex* data = buffer->getStreamData();
+			MYGUI_PLATFORM_ASSERT(data, "Vertex buffer is not created");
+
+			queueStreamDraw(data, _count, texture_id, distanceField);
+			return;
+		}
+
+		// keep draw order with already queued streaming draws
+		_flushVertexStream();
+
+		unsigned int buffer_id = buffer->getBufferID();
+		MYGUI_PLATFORM_ASSERT(buffer_id, "Vertex buffer is not created");
+
+		if (distanceField)
+		{
+			glUseProgram(mDistanceFieldProgramID);
+			glUniform1f(mDistanceFieldYScaleUniformLocation, mYScale);
+		}
+
 		glBindTexture(GL_TEXTURE_2D, texture_id);
 
     glBindVertexArray(buffer_id);
@@ -216,6 +390,19 @@ namespace MyGUI
     glBindVertexArray(0);
 
     glBindTexture(GL_TEXTURE_2D, 0);
+
+		if (distanceField)
+			glUseProgram(mProgramID);
+	}
+
+	void OpenGL3RenderManager::prepareDistanceFieldProgram()
+	{
+		// created on first use, default program stays current
+		if (mDistanceFieldProgramID == 0)
+		{
+			mDistanceFieldProgramID = createDistanceFieldShaderProgram();
+			glUseProgram(mProgramID);
+		}
 	}
 
 	void OpenGL3RenderManager::begin()
@@ -231,12 +418,237 @@ namespace MyGUI
 
 	void OpenGL3RenderManager::end()
 	{
+    _flushVertexStream();
+
     if (--mReferenceCount == 0) {
       glDisable(GL_BLEND);
       glUseProgram(0);
     }
   }
 
+	void OpenGL3RenderManager::setVertexStreaming(bool _value)
+	{
+		mVertexStreaming = _value;
+	}
+
+	bool OpenGL3RenderManager::getVertexStreaming() const
+	{
+		return mVertexStreaming;
+	}
+
+	void OpenGL3RenderManager::setTextureSlotCount(size_t _value)
+	{
+		// queued draws were batched for old slot count
+		_flushVertexStream();
+
+		mTextureSlotCount = (std::min)((std::max)(_value, (size_t)1), (size_t)MaxTextureSlots);
+	}
+
+	size_t OpenGL3RenderManager::getTextureSlotCount() const
+	{
+		return mTextureSlotCount;
+	}
+
+	void OpenGL3RenderManager::queueStreamDraw(const Vertex* _data, size_t _count, unsigned int _textureID, bool _distanceField)
+	{
+		// vertices of queued draws are contiguous, so consecutive draws with the same
+		// state are merged into one, even if they come from different nodes and layers,
+		// with texture slots a draw can also use up to mTextureSlotCount textures,
+		// distance field program has no slots, so such draws use one texture
+		float slot = 0;
+		bool merged = false;
+		if (!mStreamDraws.empty() && mStreamDraws.back().yScale == mYScale && mStreamDraws.back().distanceField == _distanceField)
+		{
+			StreamDraw& last = mStreamDraws.back();
+			size_t index = std::find(last.textureIDs, last.textureIDs + last.textureCount, _textureID) - last.textureIDs;
+			if (index == last.textureCount && index < mTextureSlotCount && !_distanceField)
+				last.textureIDs[last.textureCount++] = _textureID;
+
+			if (index < last.textureCount)
+			{
+				last.count += _count;
+				slot = (float)index;
+				merged = true;
+			}
+		}
+
+		if (!merged)
+		{
+			StreamDraw draw;
+			draw.textureIDs[0] = _textureID;
+			draw.textureCount = 1;
+			draw.first = mStreamVertices.size();
+			draw.count = _count;
+			draw.yScale = mYScale;
+			draw.distanceField = _distanceField;
+			mStreamDraws.push_back(draw);
+		}
+
+		mStreamVertices.insert(mStreamVertices.end(), _data, _data + _count);
+		if (mTextureSlotCount > 1)
+			mStreamSlots.insert(mStreamSlots.end(), _count, slot);
+	}
+
+	void OpenGL3RenderManager::_flushVertexStream()
+	{
+		if (mStreamDraws.empty())
+			return;
+
+		// slot indices, when used, are stored in the same range right after vertices
+		size_t verticesSize = mStreamVertices.size() * sizeof(Vertex);
+		size_t slotsSize = mStreamSlots.size() * sizeof(float);
+		size_t size = verticesSize + slotsSize;
+
+		if (mStreamBufferID == 0)
+		{
+			glGenBuffers(1, &mStreamBufferID);
+			glGenVertexArrays(1, &mStreamVAOID);
+
+			glBindVertexArray(mStreamVAOID);
+			glEnableVertexAttribArray(0);
+			glEnableVertexAttribArray(1);
+			glEnableVertexAttribArray(2);
+			glBindVertexArray(0);
+		}
+
+		glBindBuffer(GL_ARRAY_BUFFER, mStreamBufferID);
+
+		if (size > mStreamCapacity)
+		{
+			// grow ring buffer, old storage is released by driver when it is not used anymore
+			mStreamCapacity = (std::max)(size, mStreamCapacity * 2);
+			glBufferData(GL_ARRAY_BUFFER, mStreamCapacity, 0, GL_STREAM_DRAW);
+			mStreamOffset = 0;
+		}
+		else if (mStreamOffset + size > mStreamCapacity)
+		{
+			// ring buffer is full, orphan storage and wrap around
+			glBufferData(GL_ARRAY_BUFFER, mStreamCapacity, 0, GL_STREAM_DRAW);
+			mStreamOffset = 0;
+		}
+
+		// written range was never used since last orphaning, so no synchronisation needed
+		char* pBuffer = reinterpret_cast<char*>(glMapBufferRange(
+			GL_ARRAY_BUFFER,
+			mStreamOffset,
+			size,
+			GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_RANGE_BIT | GL_MAP_UNSYNCHRONIZED_BIT));
+		MYGUI_PLATFORM_ASSERT(pBuffer, "Error lock streaming vertex buffer");
+		memcpy(pBuffer, &mStreamVertices[0], verticesSize);
+		if (slotsSize != 0)
+			memcpy(pBuffer + verticesSize, &mStreamSlots[0], slotsSize);
+		glUnmapBuffer(GL_ARRAY_BUFFER);
+
+		// attribute pointers follow ring offset, so draws use indices relative to this flush
+		glBindVertexArray(mStreamVAOID);
+		glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, sizeof(Vertex), (GLubyte *)(mStreamOffset));
+		glVertexAttribPointer(1, 4, GL_UNSIGNED_BYTE, GL_TRUE, sizeof(Vertex), (GLubyte *)(mStreamOffset + offsetof(struct Vertex, colour)));
+		glVertexAttribPointer(2, 2, GL_FLOAT, GL_FALSE, sizeof(Vertex), (GLubyte *)(mStreamOffset + offsetof(struct Vertex, u)));
+		if (slotsSize != 0)
+		{
+			glVertexAttribPointer(3, 1, GL_FLOAT, GL_FALSE, sizeof(float), (GLubyte *)(mStreamOffset + verticesSize));
+			glEnableVertexAttribArray(3);
+		}
+		else
+		{
+			glDisableVertexAttribArray(3);
+		}
+		glBindBuffer(GL_ARRAY_BUFFER, 0);
+
+		mStreamOffset += size;
+
+		if (slotsSize != 0 && mMultiTextureProgramID == 0)
+		{
+			mMultiTextureProgramID = createMultiTextureShaderProgram();
+			glUseProgram(mProgramID);
+		}
+
+		// distance field draws use own program, other draws use multi texture program when slots are used
+		unsigned int programID = mProgramID;
+		int yScaleLocation = mYScaleUniformLocation;
+		float yScale = mYScale;
+		for (std::vector<StreamDraw>::const_iterator draw = mStreamDraws.begin(); draw != mStreamDraws.end(); ++draw)
+		{
+			unsigned int drawProgramID = mProgramID;
+			int drawYScaleLocation = mYScaleUniformLocation;
+			if (draw->distanceField)
+			{
+				drawProgramID = mDistanceFieldProgramID;
+				drawYScaleLocation = mDistanceFieldYScaleUniformLocation;
+			}
+			else if (slotsSize != 0)
+			{
+				drawProgramID = mMultiTextureProgramID;
+				drawYScaleLocation = mMultiTextureYScaleUniformLocation;
+			}
+
+			if (drawProgramID != programID)
+			{
+				programID = drawProgramID;
+				yScaleLocation = drawYScaleLocation;
+				yScale = draw->yScale;
+				glUseProgram(programID);
+				glUniform1f(yScaleLocation, yScale);
+			}
+			else if (draw->yScale != yScale)
+			{
+				yScale = draw->yScale;
+				glUniform1f(yScaleLocation, yScale);
+			}
+			for (size_t index = 0; index < draw->textureCount; ++index)
+			{
+				glActiveTexture(GL_TEXTURE0 + (GLenum)index);
+				glBindTexture(GL_TEXTURE_2D, draw->textureIDs[index]);
+			}
+			glDrawArrays(GL_TRIANGLES, (GLint)draw->first, (GLsizei)draw->count);
+		}
+		glBindVertexArray(0);
+		for (size_t index = mTextureSlotCount; index != 0; --index)
+		{
+			glActiveTexture(GL_TEXTURE0 + (GLenum)(index - 1));
+			glBindTexture(GL_TEXTURE_2D, 0);
+		}
+
+		if (programID != mProgramID)
+		{
+			// default program uniform could be changed by draws before program switch
+			glUseProgram(mProgramID);
+			glUniform1f(mYScaleUniformLocation, mYScale);
+		}
+		else if (yScale != mYScale)
+		{
+			glUniform1f(mYScaleUniformLocation, mYScale);
+		}
+
+		mStreamVertices.clear();
+		mStreamSlots.clear();
+		mStreamDraws.clear();
+	}
+
+	void OpenGL3RenderManager::destroyVertexStream()
+	{
+		if (mStreamBufferID != 0)
+		{
+			glDeleteBuffers(1, &mStreamBufferID);
+			mStreamBufferID = 0;
+		}
+		if (mStreamVAOID != 0)
+		{
+			glDeleteVertexArrays(1, &mStreamVAOID);
+			mStreamVAOID = 0;
+		}
+		if (mMultiTextureProgramID != 0)
+		{
+			glDeleteProgram(mMultiTextureProgramID);
+			mMultiTextureProgramID = 0;
+		}
+		mStreamCapacity = 0;
+		mStreamOffset = 0;
+		mStreamVertices.clear();
+		mStreamSlots.clear();
+		mStreamDraws.clear();
+	}
+
 	const RenderTargetInfo& OpenGL3RenderManager::getInfo()
 	{
 		return mInfo;
@@ -261,6 +673,11 @@ namespace MyGUI
     return false;
   }
 
+	bool OpenGL3RenderManager::isShaderSupported(const std::string& _shaderName)
+	{
+		return _shaderName == "DistanceField";
+	}
+
 	void OpenGL3RenderManager::drawOneFrame()
 	{
 		Gui* gui = Gui::getInstancePtr();
@@ -346,10 +763,16 @@ namespace MyGUI
 		}
 		mTextures.clear();
 
+		destroyVertexStream();
+
     if (mProgramID) {
       glDeleteProgram(mProgramID);
       mProgramID = 0;
     }
+    if (mDistanceFieldProgramID) {
+      glDeleteProgram(mDistanceFieldProgramID);
+      mDistanceFieldProgramID = 0;
+    }
   }
 
 } // namespace MyGUI
@@ -30,7 +30,8 @@ namespace MyGUI
         mLock(false),
         mBuffer(0),
 		mImageLoader(_loader),
-		mRenderTarget(nullptr)
+		mRenderTarget(nullptr),
+		mDistanceField(false)
 	{
 	}
 
@@ -316,6 +317,30 @@ namespace MyGUI
 		mLock = false;
 	}
 
+	bool OpenGL3Texture::updateRegion(const IntCoord& _coord, const void* _data)
+	{
+		MYGUI_PLATFORM_ASSERT(mTextureID, "Texture is not created");
+
+		// Read only rectangle from image of whole texture
+		int alignment = 0;
+		glGetIntegerv(GL_UNPACK_ALIGNMENT, &alignment);
+		glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+		glPixelStorei(GL_UNPACK_ROW_LENGTH, mWidth);
+		glPixelStorei(GL_UNPACK_SKIP_PIXELS, _coord.left);
+		glPixelStorei(GL_UNPACK_SKIP_ROWS, _coord.top);
+
+		glBindTexture(GL_TEXTURE_2D, mTextureID);
+		glTexSubImage2D(GL_TEXTURE_2D, 0, _coord.left, _coord.top, _coord.width, _coord.height, mPixelFormat, GL_UNSIGNED_BYTE, _data);
+		glBindTexture(GL_TEXTURE_2D, 0);
+
+		glPixelStorei(GL_UNPACK_SKIP_ROWS, 0);
+		glPixelStorei(GL_UNPACK_SKIP_PIXELS, 0);
+		glPixelStorei(GL_UNPACK_ROW_LENGTH, 0);
+		glPixelStorei(GL_UNPACK_ALIGNMENT, alignment);
+
+		return true;
+	}
+
 	void OpenGL3Texture::loadFromFile(const std::string& _filename)
 	{
 		destroy();
@@ -353,11 +378,24 @@ namespace MyGUI
 		return mRenderTarget;
 	}
 
+	void OpenGL3Texture::setShader(const std::string& _shaderName)
+	{
+		if (!_shaderName.empty() && !OpenGL3RenderManager::getInstance().isShaderSupported(_shaderName))
+			MYGUI_PLATFORM_LOG(Warning, "Shader '" << _shaderName << "' not found, texture '" << mName << "' uses default shader");
+
+		mDistanceField = _shaderName == "DistanceField";
+	}
+
 	unsigned int OpenGL3Texture::getTextureID() const
 	{
 		return mTextureID;
 	}
 
+	bool OpenGL3Texture::getDistanceField() const
+	{
+		return mDistanceField;
+	}
+
 	int OpenGL3Texture::getWidth()
 	{
 		return mWidth;
@@ -13,14 +13,13 @@
 namespace MyGUI
 {
 
-    //const size_t VERTEX_IN_QUAD = 6;
-    //const size_t RENDER_ITEM_STEEP_REALLOCK = 5 * VERTEX_IN_QUAD;
-
-	OpenGL3VertexBuffer::OpenGL3VertexBuffer() :
+	OpenGL3VertexBuffer::OpenGL3VertexBuffer(bool _streaming) :
       mBufferID(0), mVAOID(0),
-        //mVertexCount(RENDER_ITEM_STEEP_REALLOCK),
         mNeedVertexCount(0),
-		mSizeInBytes(0)
+		mSizeInBytes(0),
+		mRangeStart(0),
+		mRangeCount(0),
+		mStreaming(_streaming)
 	{
 	}
 
@@ -31,12 +30,8 @@ namespace MyGUI
 
 	void OpenGL3VertexBuffer::setVertexCount(size_t _count)
 	{
-		if (_count != mNeedVertexCount)
-		{
-			mNeedVertexCount = _count;
-			destroy();
-			create();
-		}
+		// buffer is reallocated on lock, only if it's capacity is not suitable
+		mNeedVertexCount = _count;
 	}
 
 	size_t OpenGL3VertexBuffer::getVertexCount()
@@ -44,8 +39,22 @@ namespace MyGUI
 		return mNeedVertexCount;
 	}
 
+	bool OpenGL3VertexBuffer::checkShrink()
+	{
+		return mCapacity.checkShrink(mNeedVertexCount);
+	}
+
 	Vertex* OpenGL3VertexBuffer::lock()
 	{
+		if (mCapacity.update(mNeedVertexCount))
+		{
+			destroy();
+			create();
+		}
+
+		if (mStreaming)
+			return &mShadowBuffer[0];
+
 		MYGUI_PLATFORM_ASSERT(mBufferID, "Vertex buffer in not created");
 
 		// Use glMapBuffer
@@ -64,11 +73,41 @@ namespace MyGUI
 		return pBuffer;
 	}
 
+	Vertex* OpenGL3VertexBuffer::lockRange(size_t _start, size_t _count)
+	{
+		if (mStreaming)
+			return &mShadowBuffer[_start];
+
+		MYGUI_PLATFORM_ASSERT(mBufferID, "Vertex buffer in not created");
+
+		// buffer drawn last frame can't be mapped without waiting for GPU and rest of its content is still in use,
+		// so range is written to memory and uploaded with glBufferSubData on unlock
+		if (_count == 0)
+			return nullptr;
+
+		mRangeBuffer.resize(_count);
+		mRangeStart = _start;
+		mRangeCount = _count;
+		return &mRangeBuffer[0];
+	}
+
 	void OpenGL3VertexBuffer::unlock()
 	{
+		if (mStreaming)
+			return;
+
 		MYGUI_PLATFORM_ASSERT(mBufferID, "Vertex buffer in not created");
 
 		glBindBuffer(GL_ARRAY_BUFFER, mBufferID);
+
+		if (mRangeCount != 0)
+		{
+			glBufferSubData(GL_ARRAY_BUFFER, mRangeStart * sizeof(Vertex), mRangeCount * sizeof(Vertex), &mRangeBuffer[0]);
+			glBindBuffer(GL_ARRAY_BUFFER, 0);
+			mRangeCount = 0;
+			return;
+		}
+
 		GLboolean result = glUnmapBuffer(GL_ARRAY_BUFFER);
 		glBindBuffer(GL_ARRAY_BUFFER, 0);
 
@@ -77,6 +116,8 @@ namespace MyGUI
 
 	void OpenGL3VertexBuffer::destroy()
 	{
+		mShadowBuffer.clear();
+
 		if (mBufferID != 0)
 		{
 			glDeleteBuffers(1, &mBufferID);
@@ -92,7 +133,13 @@ namespace MyGUI
 	{
 		MYGUI_PLATFORM_ASSERT(!mBufferID, "Vertex buffer already exist");
 
-		mSizeInBytes = mNeedVertexCount * sizeof(MyGUI::Vertex);
+		mSizeInBytes = mCapacity.getCapacity() * sizeof(MyGUI::Vertex);
+
+		if (mStreaming)
+		{
+			mShadowBuffer.resize(mCapacity.getCapacity());
+			return;
+		}
 		void* data = 0;
 
 		glGenBuffers(1, &mBufferID);
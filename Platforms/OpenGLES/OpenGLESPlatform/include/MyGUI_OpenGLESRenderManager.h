@@ -9,6 +9,7 @@
 
 #include <GLES3/gl3.h>
 #include <GLES3/gl2ext.h>
+#include <vector>
 
 namespace MyGUI
 {
@@ -50,6 +51,9 @@ namespace MyGUI
 		/** @see OpenGLESRenderManager::getTexture */
 		virtual ITexture* getTexture(const std::string& _name);
 
+		/** @see RenderManager::isShaderSupported */
+		virtual bool isShaderSupported(const std::string& _shaderName);
+
 
 		/** @see IRenderTarget::begin */
 		virtual void begin();
@@ -60,14 +64,36 @@ namespace MyGUI
 		/** @see IRenderTarget::getInfo */
 		virtual const RenderTargetInfo& getInfo();
 
+		/** Enable frame streaming arena for vertex buffers created after this call.
+			Streaming vertex buffers are kept in memory and all draws between begin and end
+			are uploaded into one shared ring buffer with a single map/unmap.
+			Consecutive draws with the same texture are merged into one draw call,
+			across layer node and layer boundaries.
+		*/
+		void setVertexStreaming(bool _value);
+		/** Is frame streaming arena enabled */
+		bool getVertexStreaming() const;
+
+		/** Set how many textures one streamed draw call can use (1 - 8, 1 by default).
+			With more than one slot vertices get texture slot index and draws with
+			different textures are batched together while draw order is preserved.
+		*/
+		void setTextureSlotCount(size_t _value);
+		/** Get how many textures one streamed draw call can use */
+		size_t getTextureSlotCount() const;
 
 	/*internal:*/
 		void drawOneFrame();
 		void setViewSize(int _width, int _height);
 		bool isPixelBufferObjectSupported() const;
+		/** Upload and draw everything that was queued in streaming arena */
+		void _flushVertexStream();
 
 	private:
 		void destroyAllResources();
+		void destroyVertexStream();
+		void bindVertexAttributes(GLuint _program, unsigned int _bufferID, size_t _offset);
+		void queueStreamDraw(const Vertex* _data, size_t _count, unsigned int _textureID, bool _distanceField);
         GLuint BuildShader(const char* source, GLenum shaderType) const;
         GLuint BuildProgram(const char* vertexShaderSource, const char* fragmentShaderSource) const;
 
@@ -91,6 +117,28 @@ namespace MyGUI
         GLuint mProgram;
         GLuint mVertShader;
         GLuint mFragShader;
+
+		enum { MaxTextureSlots = 8 };
+
+		struct StreamDraw
+		{
+			unsigned int textureIDs[MaxTextureSlots];
+			size_t textureCount;
+			size_t first;
+			size_t count;
+			bool distanceField;
+		};
+
+		bool mVertexStreaming;
+		GLuint mStreamBufferID;
+		size_t mStreamCapacity;
+		size_t mStreamOffset;
+		size_t mTextureSlotCount;
+		GLuint mMultiTextureProgram;
+		GLuint mDistanceFieldProgram;
+		std::vector<Vertex> mStreamVertices;
+		std::vector<float> mStreamSlots;
+		std::vector<StreamDraw> mStreamDraws;
 	};
 
 } // namespace MyGUI
@@ -43,6 +43,7 @@ namespace MyGUI
 		{
 			return mLock;
 		}
+		virtual bool updateRegion(const IntCoord& _coord, const void* _data);
 
 		virtual PixelFormat getFormat()
 		{
@@ -59,8 +60,11 @@ namespace MyGUI
 
 		virtual IRenderTarget* getRenderTarget();
 
+		virtual void setShader(const std::string& _shaderName);
+
 	/*internal:*/
 		unsigned int getTextureID() const;
+		bool getDistanceField() const;
 		void setUsage(TextureUsage _usage);
 		void createManual(int _width, int _height, TextureUsage _usage, PixelFormat _format, void* _data);
 
@@ -85,6 +89,7 @@ namespace MyGUI
 		TextureUsage mOriginalUsage;
 		OpenGLESImageLoader* mImageLoader;
 		OpenGLESRTTexture* mRenderTarget;
+		bool mDistanceField;
 	};
 
 } // namespace MyGUI
@@ -3,6 +3,8 @@
 
 #include "MyGUI_Prerequest.h"
 #include "MyGUI_IVertexBuffer.h"
+#include "MyGUI_VertexBufferCapacity.h"
+#include <vector>
 
 #include <GLES3/gl3.h>
 #include <GLES3/gl2ext.h>
@@ -13,7 +15,7 @@ namespace MyGUI
 	class OpenGLESVertexBuffer : public IVertexBuffer
 	{
 	public:
-		OpenGLESVertexBuffer();
+		OpenGLESVertexBuffer(bool _streaming = false);
 		virtual ~OpenGLESVertexBuffer();
 
 		virtual void setVertexCount(size_t _count);
@@ -21,6 +23,9 @@ namespace MyGUI
 
 		virtual Vertex* lock();
 		virtual void unlock();
+		virtual bool checkShrink();
+
+		virtual Vertex* lockRange(size_t _start, size_t _count);
 
 	/*internal:*/
 		void destroy();
@@ -31,11 +36,28 @@ namespace MyGUI
 			return mBufferID;
 		}
 
+		// streaming buffers keep vertices in memory, they are uploaded by OpenGLESRenderManager
+		bool isStreaming() const
+		{
+			return mStreaming;
+		}
+
+		const Vertex* getStreamData() const
+		{
+			return mShadowBuffer.empty() ? nullptr : &mShadowBuffer[0];
+		}
+
 	private:
 		unsigned int mBufferID;
-		size_t mVertexCount;
+		VertexBufferCapacity mCapacity;
 		size_t mNeedVertexCount;
 		size_t mSizeInBytes;
+		// changed range, uploaded on unlock
+		std::vector<Vertex> mRangeBuffer;
+		size_t mRangeStart;
+		size_t mRangeCount;
+		bool mStreaming;
+		std::vector<Vertex> mShadowBuffer;
 	};
 
 } // namespace MyGUI
@@ -1,7 +1,7 @@
 #include "MyGUI_OpenGLESDataManager.h"
 #include "MyGUI_OpenGLESDiagnostic.h"
 #include "MyGUI_DataFileStream.h"
-#include "FileSystemInfo/FileSystemInfo.h"
+#include "FileSystemInfo/DataFileIndex.h"
 #include <fstream>
 
 #include "MyGUI_Diagnostic.h"
@@ -10,10 +10,16 @@ namespace MyGUI
 {
 
 	OpenGLESDataManager::OpenGLESDataManager() :
+		mIndex(new common::DataFileIndex()),
 		mIsInitialise(false)
 	{
 	}
 
+	OpenGLESDataManager::~OpenGLESDataManager()
+	{
+		delete mIndex;
+	}
+
 	void OpenGLESDataManager::initialise()
 	{
 		MYGUI_PLATFORM_ASSERT(!mIsInitialise, getClassTypeName() << " initialised twice");
@@ -69,10 +75,7 @@ namespace MyGUI
 		common::VectorWString wresult;
 		result.clear();
 
-		for (VectorArhivInfo::const_iterator item = mPaths.begin(); item != mPaths.end(); ++item)
-		{
-			common::scanFolder(wresult, (*item).name, (*item).recursive, MyGUI::UString(_pattern).asWStr(), false);
-		}
+		mIndex->scan(wresult, MyGUI::UString(_pattern).asWStr(), false);
 
 		for (common::VectorWString::const_iterator item = wresult.begin(); item != wresult.end(); ++item)
 		{
@@ -87,11 +90,9 @@ namespace MyGUI
 		static std::string path;
 		VectorString result;
 		common::VectorWString wresult;
+		path.clear();
 
-		for (VectorArhivInfo::const_iterator item = mPaths.begin(); item != mPaths.end(); ++item)
-		{
-			common::scanFolder(wresult, (*item).name, (*item).recursive, MyGUI::UString(_name).asWStr(), true);
-		}
+		mIndex->scan(wresult, MyGUI::UString(_name).asWStr(), true);
 
 		for (common::VectorWString::const_iterator item = wresult.begin(); item != wresult.end(); ++item)
 		{
@@ -104,10 +105,12 @@ namespace MyGUI
 
 	void OpenGLESDataManager::addResourceLocation(const std::string& _name, bool _recursive)
 	{
-		ArhivInfo info;
-		info.name = MyGUI::UString(_name).asWStr();
-		info.recursive = _recursive;
-		mPaths.push_back(info);
+		mIndex->addLocation(MyGUI::UString(_name).asWStr(), _recursive);
+	}
+
+	void OpenGLESDataManager::setCheckLocationChanges(bool _value)
+	{
+		mIndex->setCheckChanges(_value);
 	}
 
 } // namespace MyGUI
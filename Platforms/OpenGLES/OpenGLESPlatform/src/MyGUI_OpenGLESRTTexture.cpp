@@ -83,6 +83,9 @@ namespace MyGUI
 
 	void OpenGLESRTTexture::begin()
 	{
+		// draws queued for previous target must be done before target switch
+		OpenGLESRenderManager::getInstance()._flushVertexStream();
+
 		//glPushAttrib(GL_VIEWPORT_BIT);
 
 		glBindFramebuffer(GL_FRAMEBUFFER, mFBOID);
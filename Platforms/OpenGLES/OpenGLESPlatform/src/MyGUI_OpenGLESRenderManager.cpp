@@ -9,6 +9,9 @@
 #include <GLES3/gl2ext.h>
 #include "platform.h"
 
+#include <algorithm>
+#include <cstring>
+
 const char* vShader = " \n\
 \n\
 attribute vec3 a_position;                             \n\
@@ -37,6 +40,71 @@ void main(void) {                                      \n\
 }                                                      \n\
 ";
 
+// same as default shaders, but texture is selected by per vertex slot index
+const char* vShaderMultiTexture = " \n\
+\n\
+attribute vec3 a_position;                             \n\
+attribute vec4 a_color;                                \n\
+attribute vec2 a_texCoord;                             \n\
+attribute float a_slot;                                \n\
+\n\
+varying lowp vec4 v_fragmentColor;                     \n\
+varying mediump vec2 v_texCoord;                       \n\
+varying mediump float v_slot;                          \n\
+\n\
+void main()                                            \n\
+{                                                      \n\
+gl_Position = (vec4(a_position,1));                    \n\
+v_fragmentColor = a_color;                             \n\
+v_texCoord = a_texCoord;                               \n\
+v_slot = a_slot;                                       \n\
+}                                                      \n\
+";
+
+const char* fShaderMultiTexture = " \n\
+precision lowp float;                                  \n\
+varying vec4 v_fragmentColor;                          \n\
+varying vec2 v_texCoord;                               \n\
+varying mediump float v_slot;                          \n\
+uniform sampler2D u_textures[8];                       \n\
+void main(void) {                                      \n\
+    vec4 texel;                                        \n\
+    if (v_slot < 0.5) texel = texture2D(u_textures[0], v_texCoord);        \n\
+    else if (v_slot < 1.5) texel = texture2D(u_textures[1], v_texCoord);   \n\
+    else if (v_slot < 2.5) texel = texture2D(u_textures[2], v_texCoord);   \n\
+    else if (v_slot < 3.5) texel = texture2D(u_textures[3], v_texCoord);   \n\
+    else if (v_slot < 4.5) texel = texture2D(u_textures[4], v_texCoord);   \n\
+    else if (v_slot < 5.5) texel = texture2D(u_textures[5], v_texCoord);   \n\
+    else if (v_slot < 6.5) texel = texture2D(u_textures[6], v_texCoord);   \n\
+    else texel = texture2D(u_textures[7], v_texCoord);                     \n\
+    gl_FragColor = texel.zyxw * v_fragmentColor;       \n\
+}                                                      \n\
+";
+
+// used with default vertex shader, alpha of green pixels is distance to glyph outline (0.5 on outline),
+// grey pixels (cursor and selection glyphs) are drawn as usual, edge is antialiased over one screen pixel
+// when derivatives are available
+const char* fShaderDistanceField = " \n\
+#ifdef GL_OES_standard_derivatives                     \n\
+#extension GL_OES_standard_derivatives : enable        \n\
+#endif                                                 \n\
+precision mediump float;                               \n\
+varying vec4 v_fragmentColor;                          \n\
+varying vec2 v_texCoord;                               \n\
+uniform sampler2D u_texture;                           \n\
+void main(void) {                                      \n\
+    vec4 texel = texture2D(u_texture, v_texCoord);     \n\
+    float distanceField = clamp(texel.y - texel.x, 0.0, 1.0);               \n\
+#ifdef GL_OES_standard_derivatives                     \n\
+    float width = max(0.5 * fwidth(texel.w), 0.001);   \n\
+#else                                                  \n\
+    float width = 0.06;                                \n\
+#endif                                                 \n\
+    float alpha = smoothstep(0.5 - width, 0.5 + width, texel.w);            \n\
+    gl_FragColor = vec4(mix(texel.zyx, vec3(1.0), distanceField), mix(texel.w, alpha, distanceField)) * v_fragmentColor;   \n\
+}                                                      \n\
+";
+
 namespace MyGUI
 {
 
@@ -44,7 +112,14 @@ namespace MyGUI
 		mUpdate(false),
 		mImageLoader(nullptr),
 		mPboIsSupported(false),
-		mIsInitialise(false)
+		mIsInitialise(false),
+		mVertexStreaming(false),
+		mStreamBufferID(0),
+		mStreamCapacity(0),
+		mStreamOffset(0),
+		mTextureSlotCount(1),
+		mMultiTextureProgram(0),
+		mDistanceFieldProgram(0)
 	{
 	}
 
@@ -79,7 +154,7 @@ namespace MyGUI
 
 	IVertexBuffer* OpenGLESRenderManager::createVertexBuffer()
 	{
-		return new OpenGLESVertexBuffer();
+		return new OpenGLESVertexBuffer(mVertexStreaming);
 	}
 
 	void OpenGLESRenderManager::destroyVertexBuffer(IVertexBuffer* _buffer)
@@ -130,62 +205,287 @@ namespace MyGUI
 		return programHandle;
 	}
 
+	void OpenGLESRenderManager::bindVertexAttributes(GLuint _program, unsigned int _bufferID, size_t _offset)
+	{
+		glBindBuffer(GL_ARRAY_BUFFER, _bufferID);
+		CHECK_GL_ERROR_DEBUG();
+
+		GLuint positionSlot = glGetAttribLocation(_program, "a_position");
+		GLuint colorSlot = glGetAttribLocation(_program, "a_color");
+		GLuint texSlot = glGetAttribLocation(_program, "a_texCoord");
+
+
+		glEnableVertexAttribArray(positionSlot);
+		glEnableVertexAttribArray(colorSlot);
+		glEnableVertexAttribArray(texSlot);
+
+		glUseProgram(_program);
+
+
+		size_t offset = _offset;
+		int diff = offsetof(Vertex, x);
+		glVertexAttribPointer(positionSlot, 3, GL_FLOAT, GL_FALSE, sizeof(Vertex), (void*) (offset + diff));
+		CHECK_GL_ERROR_DEBUG();
+
+		diff = offsetof(Vertex, colour);
+		glVertexAttribPointer(colorSlot, 4, GL_UNSIGNED_BYTE, GL_TRUE, sizeof(Vertex), (void*) (offset + diff));
+		CHECK_GL_ERROR_DEBUG();
+
+		diff = offsetof(Vertex, u);
+		glVertexAttribPointer(texSlot, 2, GL_FLOAT, GL_FALSE, sizeof(Vertex), (void*) (offset + diff));
+		CHECK_GL_ERROR_DEBUG();
+
+		if (_program != mMultiTextureProgram)
+		{
+			GLuint textureUniform = glGetUniformLocation(_program, "u_texture");
+			glUniform1i(textureUniform, 0);
+		}
+		else
+		{
+			GLint units[MaxTextureSlots];
+			for (int index = 0; index < MaxTextureSlots; ++index)
+				units[index] = index;
+
+			GLuint texturesUniform = glGetUniformLocation(_program, "u_textures");
+			glUniform1iv(texturesUniform, MaxTextureSlots, units);
+		}
+	}
+
 	void OpenGLESRenderManager::doRender(IVertexBuffer* _buffer, ITexture* _texture, size_t _count)
 	{
 		OpenGLESVertexBuffer* buffer = static_cast<OpenGLESVertexBuffer*>(_buffer);
-		unsigned int buffer_id = buffer->getBufferID();
-		MYGUI_PLATFORM_ASSERT(buffer_id, "Vertex buffer is not created");
 
 		unsigned int texture_id = 0;
+		bool distanceField = false;
 		if (_texture)
 		{
 			OpenGLESTexture* texture = static_cast<OpenGLESTexture*>(_texture);
 			texture_id = texture->getTextureID();
+			distanceField = texture->getDistanceField();
 			//MYGUI_PLATFORM_ASSERT(texture_id, "Texture is not created");
 		}
 
+		if (distanceField && mDistanceFieldProgram == 0)
+			mDistanceFieldProgram = BuildProgram(vShader, fShaderDistanceField);
+
+		if (buffer->isStreaming())
+		{
+			const Vertex* data = buffer->getStreamData();
+			MYGUI_PLATFORM_ASSERT(data, "Vertex buffer is not created");
+
+			queueStreamDraw(data, _count, texture_id, distanceField);
+			return;
+		}
+
+		// keep draw order with already queued streaming draws
+		_flushVertexStream();
+
+		unsigned int buffer_id = buffer->getBufferID();
+		MYGUI_PLATFORM_ASSERT(buffer_id, "Vertex buffer is not created");
+
 		glBindTexture(GL_TEXTURE_2D, texture_id);
 		CHECK_GL_ERROR_DEBUG();
 
-		glBindBuffer(GL_ARRAY_BUFFER, buffer_id);
+		bindVertexAttributes(distanceField ? mDistanceFieldProgram : mProgram, buffer_id, 0);
+
+		glDrawArrays(GL_TRIANGLES, 0, _count);
 		CHECK_GL_ERROR_DEBUG();
 
-		GLuint positionSlot = glGetAttribLocation(mProgram, "a_position");
-		GLuint colorSlot = glGetAttribLocation(mProgram, "a_color");
-		GLuint texSlot = glGetAttribLocation(mProgram, "a_texCoord");
+		glBindBuffer(GL_ARRAY_BUFFER, 0);
+		CHECK_GL_ERROR_DEBUG();
+		glBindTexture(GL_TEXTURE_2D, 0);
+		CHECK_GL_ERROR_DEBUG();
+	}
+
+	void OpenGLESRenderManager::setVertexStreaming(bool _value)
+	{
+		mVertexStreaming = _value;
+	}
 
-		GLuint textureUniform = glGetUniformLocation(mProgram, "u_texture");
+	bool OpenGLESRenderManager::getVertexStreaming() const
+	{
+		return mVertexStreaming;
+	}
 
+	void OpenGLESRenderManager::setTextureSlotCount(size_t _value)
+	{
+		// queued draws were batched for old slot count
+		_flushVertexStream();
 
-		glEnableVertexAttribArray(positionSlot);
-		glEnableVertexAttribArray(colorSlot);
-		glEnableVertexAttribArray(texSlot);
+		mTextureSlotCount = (std::min)((std::max)(_value, (size_t)1), (size_t)MaxTextureSlots);
+	}
 
-		glUseProgram(mProgram);
+	size_t OpenGLESRenderManager::getTextureSlotCount() const
+	{
+		return mTextureSlotCount;
+	}
 
+	void OpenGLESRenderManager::queueStreamDraw(const Vertex* _data, size_t _count, unsigned int _textureID, bool _distanceField)
+	{
+		// vertices of queued draws are contiguous, so consecutive draws with the same
+		// state are merged into one, even if they come from different nodes and layers,
+		// with texture slots a draw can also use up to mTextureSlotCount textures,
+		// distance field program has no slots, so such draws use one texture
+		float slot = 0;
+		bool merged = false;
+		if (!mStreamDraws.empty() && mStreamDraws.back().distanceField == _distanceField)
+		{
+			StreamDraw& last = mStreamDraws.back();
+			size_t index = std::find(last.textureIDs, last.textureIDs + last.textureCount, _textureID) - last.textureIDs;
+			if (index == last.textureCount && index < mTextureSlotCount && !_distanceField)
+				last.textureIDs[last.textureCount++] = _textureID;
+
+			if (index < last.textureCount)
+			{
+				last.count += _count;
+				slot = (float)index;
+				merged = true;
+			}
+		}
 
-		size_t offset = 0;
-		int diff = offsetof(Vertex, x);
-		glVertexAttribPointer(positionSlot, 3, GL_FLOAT, GL_FALSE, sizeof(Vertex), (void*) (offset + diff));
-		CHECK_GL_ERROR_DEBUG();
+		if (!merged)
+		{
+			StreamDraw draw;
+			draw.textureIDs[0] = _textureID;
+			draw.textureCount = 1;
+			draw.first = mStreamVertices.size();
+			draw.count = _count;
+			draw.distanceField = _distanceField;
+			mStreamDraws.push_back(draw);
+		}
 
-		diff = offsetof(Vertex, colour);
-		glVertexAttribPointer(colorSlot, 4, GL_UNSIGNED_BYTE, GL_TRUE, sizeof(Vertex), (void*) (offset + diff));
-		CHECK_GL_ERROR_DEBUG();
+		mStreamVertices.insert(mStreamVertices.end(), _data, _data + _count);
+		if (mTextureSlotCount > 1)
+			mStreamSlots.insert(mStreamSlots.end(), _count, slot);
+	}
 
-		diff = offsetof(Vertex, u);
-		glVertexAttribPointer(texSlot, 2, GL_FLOAT, GL_FALSE, sizeof(Vertex), (void*) (offset + diff));
+	void OpenGLESRenderManager::_flushVertexStream()
+	{
+		if (mStreamDraws.empty())
+			return;
+
+		// slot indices, when used, are stored in the same range right after vertices
+		size_t verticesSize = mStreamVertices.size() * sizeof(Vertex);
+		size_t slotsSize = mStreamSlots.size() * sizeof(float);
+		size_t size = verticesSize + slotsSize;
+
+		if (mStreamBufferID == 0)
+		{
+			glGenBuffers(1, &mStreamBufferID);
+			CHECK_GL_ERROR_DEBUG();
+		}
+
+		glBindBuffer(GL_ARRAY_BUFFER, mStreamBufferID);
 		CHECK_GL_ERROR_DEBUG();
 
-		glUniform1i(textureUniform, 0);
+		if (size > mStreamCapacity)
+		{
+			// grow ring buffer, old storage is released by driver when it is not used anymore
+			mStreamCapacity = (std::max)(size, mStreamCapacity * 2);
+			glBufferData(GL_ARRAY_BUFFER, mStreamCapacity, 0, GL_STREAM_DRAW);
+			CHECK_GL_ERROR_DEBUG();
+			mStreamOffset = 0;
+		}
+		else if (mStreamOffset + size > mStreamCapacity)
+		{
+			// ring buffer is full, orphan storage and wrap around
+			glBufferData(GL_ARRAY_BUFFER, mStreamCapacity, 0, GL_STREAM_DRAW);
+			CHECK_GL_ERROR_DEBUG();
+			mStreamOffset = 0;
+		}
 
-		glDrawArrays(GL_TRIANGLES, 0, _count);
+		// written range was never used since last orphaning, so no synchronisation needed
+		char* pBuffer = (char*) glMapBufferRange(
+			GL_ARRAY_BUFFER,
+			mStreamOffset,
+			size,
+			GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_RANGE_BIT | GL_MAP_UNSYNCHRONIZED_BIT);
+		CHECK_GL_ERROR_DEBUG();
+		MYGUI_PLATFORM_ASSERT(pBuffer, "Error lock streaming vertex buffer");
+		memcpy(pBuffer, &mStreamVertices[0], verticesSize);
+		if (slotsSize != 0)
+			memcpy(pBuffer + verticesSize, &mStreamSlots[0], slotsSize);
+		glUnmapBuffer(GL_ARRAY_BUFFER);
 		CHECK_GL_ERROR_DEBUG();
 
+		if (slotsSize != 0 && mMultiTextureProgram == 0)
+			mMultiTextureProgram = BuildProgram(vShaderMultiTexture, fShaderMultiTexture);
+
+		size_t offset = mStreamOffset;
+		mStreamOffset += size;
+
+		// distance field draws use own program, other draws use multi texture program when slots are used,
+		// attribute locations differ between programs, so they are bound again on program switch
+		GLuint program = 0;
+		GLuint slotAttribute = 0;
+		bool slotAttributeEnabled = false;
+		for (std::vector<StreamDraw>::const_iterator draw = mStreamDraws.begin(); draw != mStreamDraws.end(); ++draw)
+		{
+			GLuint drawProgram = mProgram;
+			if (draw->distanceField)
+				drawProgram = mDistanceFieldProgram;
+			else if (slotsSize != 0)
+				drawProgram = mMultiTextureProgram;
+
+			if (drawProgram != program)
+			{
+				program = drawProgram;
+				bindVertexAttributes(program, mStreamBufferID, offset);
+				if (program == mMultiTextureProgram)
+				{
+					slotAttribute = glGetAttribLocation(program, "a_slot");
+					glEnableVertexAttribArray(slotAttribute);
+					glVertexAttribPointer(slotAttribute, 1, GL_FLOAT, GL_FALSE, sizeof(float), (void*) (offset + verticesSize));
+					CHECK_GL_ERROR_DEBUG();
+					slotAttributeEnabled = true;
+				}
+			}
+
+			for (size_t index = 0; index < draw->textureCount; ++index)
+			{
+				glActiveTexture(GL_TEXTURE0 + (GLenum) index);
+				glBindTexture(GL_TEXTURE_2D, draw->textureIDs[index]);
+			}
+			glDrawArrays(GL_TRIANGLES, (GLint)draw->first, (GLsizei)draw->count);
+			CHECK_GL_ERROR_DEBUG();
+		}
+
+		if (slotAttributeEnabled)
+			glDisableVertexAttribArray(slotAttribute);
+
 		glBindBuffer(GL_ARRAY_BUFFER, 0);
 		CHECK_GL_ERROR_DEBUG();
-		glBindTexture(GL_TEXTURE_2D, 0);
+		for (size_t index = mTextureSlotCount; index != 0; --index)
+		{
+			glActiveTexture(GL_TEXTURE0 + (GLenum) (index - 1));
+			glBindTexture(GL_TEXTURE_2D, 0);
+		}
 		CHECK_GL_ERROR_DEBUG();
+
+		mStreamVertices.clear();
+		mStreamSlots.clear();
+		mStreamDraws.clear();
+	}
+
+	void OpenGLESRenderManager::destroyVertexStream()
+	{
+		if (mStreamBufferID != 0)
+		{
+			glDeleteBuffers(1, &mStreamBufferID);
+			CHECK_GL_ERROR_DEBUG();
+			mStreamBufferID = 0;
+		}
+		if (mMultiTextureProgram != 0)
+		{
+			glDeleteProgram(mMultiTextureProgram);
+			CHECK_GL_ERROR_DEBUG();
+			mMultiTextureProgram = 0;
+		}
+		mStreamCapacity = 0;
+		mStreamOffset = 0;
+		mStreamVertices.clear();
+		mStreamSlots.clear();
+		mStreamDraws.clear();
 	}
 
 	void OpenGLESRenderManager::begin()
@@ -205,7 +505,7 @@ namespace MyGUI
 
 	void OpenGLESRenderManager::end()
 	{
-
+		_flushVertexStream();
 	}
 
 	const RenderTargetInfo& OpenGLESRenderManager::getInfo()
@@ -307,6 +607,20 @@ namespace MyGUI
 			delete item->second;
 		}
 		mTextures.clear();
+
+		destroyVertexStream();
+
+		if (mDistanceFieldProgram != 0)
+		{
+			glDeleteProgram(mDistanceFieldProgram);
+			CHECK_GL_ERROR_DEBUG();
+			mDistanceFieldProgram = 0;
+		}
+	}
+
+	bool OpenGLESRenderManager::isShaderSupported(const std::string& _shaderName)
+	{
+		return _shaderName == "DistanceField";
 	}
 
 } // namespace MyGUI
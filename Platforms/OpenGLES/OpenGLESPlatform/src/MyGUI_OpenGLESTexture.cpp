@@ -24,7 +24,8 @@ namespace MyGUI
 		mAccess(0),
 		mNumElemBytes(0),
 		mImageLoader(_loader),
-		mRenderTarget(nullptr)
+		mRenderTarget(nullptr),
+		mDistanceField(false)
 	{
 	}
 
@@ -296,6 +297,32 @@ namespace MyGUI
 		mLock = false;
 	}
 
+	bool OpenGLESTexture::updateRegion(const IntCoord& _coord, const void* _data)
+	{
+		MYGUI_PLATFORM_ASSERT(mTextureID, "Texture is not created");
+
+		// GLES has no GL_UNPACK_ROW_LENGTH, so rows of rectangle are gathered first
+		size_t rowSize = _coord.width * mNumElemBytes;
+		std::vector<unsigned char> region(rowSize * _coord.height);
+		const unsigned char* source = static_cast<const unsigned char*>(_data);
+		for (int y = 0; y < _coord.height; ++y)
+			memcpy(&region[y * rowSize], source + ((_coord.top + y) * mWidth + _coord.left) * mNumElemBytes, rowSize);
+
+		int alignment = 0;
+		glGetIntegerv(GL_UNPACK_ALIGNMENT, &alignment);
+		glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+
+		glBindTexture(GL_TEXTURE_2D, mTextureID);
+		CHECK_GL_ERROR_DEBUG();
+		glTexSubImage2D(GL_TEXTURE_2D, 0, _coord.left, _coord.top, _coord.width, _coord.height, mPixelFormat, GL_UNSIGNED_BYTE, &region[0]);
+		CHECK_GL_ERROR_DEBUG();
+		glBindTexture(GL_TEXTURE_2D, 0);
+
+		glPixelStorei(GL_UNPACK_ALIGNMENT, alignment);
+
+		return true;
+	}
+
 	void OpenGLESTexture::loadFromFile(const std::string& _filename)
 	{
 		destroy();
@@ -333,9 +360,22 @@ namespace MyGUI
 		return mRenderTarget;
 	}
 
+	void OpenGLESTexture::setShader(const std::string& _shaderName)
+	{
+		if (!_shaderName.empty() && !OpenGLESRenderManager::getInstance().isShaderSupported(_shaderName))
+			MYGUI_PLATFORM_LOG(Warning, "Shader '" << _shaderName << "' not found, texture '" << mName << "' uses default shader");
+
+		mDistanceField = _shaderName == "DistanceField";
+	}
+
 	unsigned int OpenGLESTexture::getTextureID() const
 	{
 		return mTextureID;
 	}
 
+	bool OpenGLESTexture::getDistanceField() const
+	{
+		return mDistanceField;
+	}
+
 } // namespace MyGUI
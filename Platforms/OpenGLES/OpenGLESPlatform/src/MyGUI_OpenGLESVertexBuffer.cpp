@@ -8,14 +8,13 @@
 namespace MyGUI
 {
 
-	const size_t VERTEX_IN_QUAD = 6;
-	const size_t RENDER_ITEM_STEEP_REALLOCK = 5 * VERTEX_IN_QUAD;
-
-	OpenGLESVertexBuffer::OpenGLESVertexBuffer() :
+	OpenGLESVertexBuffer::OpenGLESVertexBuffer(bool _streaming) :
 		mNeedVertexCount(0),
-		mVertexCount(RENDER_ITEM_STEEP_REALLOCK),
 		mBufferID(0),
-		mSizeInBytes(0)
+		mSizeInBytes(0),
+		mRangeStart(0),
+		mRangeCount(0),
+		mStreaming(_streaming)
 	{
 	}
 
@@ -26,12 +25,8 @@ namespace MyGUI
 
 	void OpenGLESVertexBuffer::setVertexCount(size_t _count)
 	{
-		if (_count != mNeedVertexCount)
-		{
-			mNeedVertexCount = _count;
-			destroy();
-			create();
-		}
+		// buffer is reallocated on lock, only if it's capacity is not suitable
+		mNeedVertexCount = _count;
 	}
 
 	size_t OpenGLESVertexBuffer::getVertexCount()
@@ -39,8 +34,22 @@ namespace MyGUI
 		return mNeedVertexCount;
 	}
 
+	bool OpenGLESVertexBuffer::checkShrink()
+	{
+		return mCapacity.checkShrink(mNeedVertexCount);
+	}
+
 	Vertex* OpenGLESVertexBuffer::lock()
 	{
+		if (mCapacity.update(mNeedVertexCount))
+		{
+			destroy();
+			create();
+		}
+
+		if (mStreaming)
+			return &mShadowBuffer[0];
+
 		MYGUI_PLATFORM_ASSERT(mBufferID, "Vertex buffer in not created");
 
 		// Use glMapBuffer
@@ -67,12 +76,44 @@ namespace MyGUI
 		return pBuffer;
 	}
 
+	Vertex* OpenGLESVertexBuffer::lockRange(size_t _start, size_t _count)
+	{
+		if (mStreaming)
+			return &mShadowBuffer[_start];
+
+		MYGUI_PLATFORM_ASSERT(mBufferID, "Vertex buffer in not created");
+
+		// buffer drawn last frame can't be mapped without waiting for GPU and rest of its content is still in use,
+		// so range is written to memory and uploaded with glBufferSubData on unlock
+		if (_count == 0)
+			return nullptr;
+
+		mRangeBuffer.resize(_count);
+		mRangeStart = _start;
+		mRangeCount = _count;
+		return &mRangeBuffer[0];
+	}
+
 	void OpenGLESVertexBuffer::unlock()
 	{
+		if (mStreaming)
+			return;
+
 		MYGUI_PLATFORM_ASSERT(mBufferID, "Vertex buffer in not created");
 
 		glBindBuffer(GL_ARRAY_BUFFER, mBufferID);
 		CHECK_GL_ERROR_DEBUG();
+
+		if (mRangeCount != 0)
+		{
+			glBufferSubData(GL_ARRAY_BUFFER, mRangeStart * sizeof(Vertex), mRangeCount * sizeof(Vertex), &mRangeBuffer[0]);
+			CHECK_GL_ERROR_DEBUG();
+			glBindBuffer(GL_ARRAY_BUFFER, 0);
+			CHECK_GL_ERROR_DEBUG();
+			mRangeCount = 0;
+			return;
+		}
+
 		GLboolean result = glUnmapBuffer(GL_ARRAY_BUFFER);
 		CHECK_GL_ERROR_DEBUG();
 		glBindBuffer(GL_ARRAY_BUFFER, 0);
@@ -83,6 +124,8 @@ namespace MyGUI
 
 	void OpenGLESVertexBuffer::destroy()
 	{
+		mShadowBuffer.clear();
+
 		if (mBufferID != 0)
 		{
 			glDeleteBuffers(1, (GLuint * ) & mBufferID);
@@ -95,7 +138,14 @@ namespace MyGUI
 	{
 		MYGUI_PLATFORM_ASSERT(!mBufferID, "Vertex buffer already exist");
 
-		mSizeInBytes = mNeedVertexCount * sizeof(MyGUI::Vertex);
+		mSizeInBytes = mCapacity.getCapacity() * sizeof(MyGUI::Vertex);
+
+		if (mStreaming)
+		{
+			mShadowBuffer.resize(mCapacity.getCapacity());
+			return;
+		}
+
 		void* data = 0;
 
 		glGenBuffers(1, (GLuint * ) & mBufferID); //wdy
@@ -241,6 +241,10 @@ namespace tools
 				return;
 			texture->saveToFile(MyGUI::UString(common::concatenatePath(_folderName, MyGUI::UString(textureName))).asUTF8());
 
+			// cache for ResourceTrueTypeFont with property Cache, loaded without rendering
+			std::string cacheName = _data->getPropertyValue("Name") + ".fontcache";
+			font->saveCache(MyGUI::UString(common::concatenatePath(_folderName, MyGUI::UString(cacheName))).asUTF8());
+
 			MyGUI::xml::ElementPtr node = _root->createChild("Resource");
 			node->addAttribute("type", "ResourceManualFont");
 			node->addAttribute("name", _data->getPropertyValue("Name"));
@@ -0,0 +1,111 @@
+/*
+ * This source file is part of MyGUI. For the latest info, see http://mygui.info/
+ * Distributed under the MIT License
+ * (See accompanying file COPYING.MIT or copy at http://opensource.org/licenses/MIT)
+ */
+
+#include "MyGUI_XmlDocument.h"
+#include <iostream>
+#include <string>
+#include <vector>
+#include <sys/types.h>
+#include <sys/stat.h>
+#if MYGUI_PLATFORM == MYGUI_PLATFORM_WIN32
+#	include <stdlib.h>
+#	include <string.h>
+#endif
+
+namespace
+{
+
+	void printUsage(const char* _name)
+	{
+		std::cerr << "usage: " << _name << " --output <dir> <file.xml> [<file.xml> ...]" << std::endl;
+		std::cerr << "compiles MyGUI xml files to binary form with same names, that is loaded without parsing text" << std::endl;
+		std::cerr << "output folder has to differ from folders of source files" << std::endl;
+	}
+
+	std::string getFileName(const std::string& _path)
+	{
+		size_t pos = _path.find_last_of("/\\");
+		return pos == std::string::npos ? _path : _path.substr(pos + 1);
+	}
+
+	// binary file must never replace xml it was compiled from
+	bool isSameFile(const std::string& _source, const std::string& _destination)
+	{
+#if MYGUI_PLATFORM == MYGUI_PLATFORM_WIN32
+		char source[_MAX_PATH];
+		char destination[_MAX_PATH];
+		if (_fullpath(source, _source.c_str(), _MAX_PATH) == nullptr || _fullpath(destination, _destination.c_str(), _MAX_PATH) == nullptr)
+			return false;
+		return _stricmp(source, destination) == 0;
+#else
+		struct stat source;
+		struct stat destination;
+		if (stat(_source.c_str(), &source) != 0 || stat(_destination.c_str(), &destination) != 0)
+			return false;
+		return source.st_dev == destination.st_dev && source.st_ino == destination.st_ino;
+#endif
+	}
+
+} // namespace
+
+int main(int argc, char* argv[])
+{
+	std::string outputDir;
+	std::vector<std::string> files;
+
+	for (int index = 1; index < argc; ++index)
+	{
+		std::string key = argv[index];
+		if (key == "--output")
+		{
+			if (index + 1 >= argc)
+			{
+				printUsage(argv[0]);
+				return 1;
+			}
+			outputDir = argv[++index];
+		}
+		else if (!key.empty() && key[0] == '-')
+		{
+			printUsage(argv[0]);
+			return 1;
+		}
+		else
+		{
+			files.push_back(key);
+		}
+	}
+
+	if (files.empty() || outputDir.empty())
+	{
+		printUsage(argv[0]);
+		return 1;
+	}
+
+	int result = 0;
+	for (std::vector<std::string>::const_iterator file = files.begin(); file != files.end(); ++file)
+	{
+		std::string destination = outputDir + "/" + getFileName(*file);
+		if (isSameFile(*file, destination))
+		{
+			std::cerr << "'" << *file << "' would be overwritten by its binary form, choose other output folder" << std::endl;
+			result = 1;
+			continue;
+		}
+
+		MyGUI::xml::Document doc;
+		if (!doc.open(*file) || !doc.saveBinary(destination))
+		{
+			std::cerr << doc.getLastError() << std::endl;
+			result = 1;
+			continue;
+		}
+
+		std::cout << *file << " -> " << destination << std::endl;
+	}
+
+	return result;
+}